@@ -0,0 +1,37 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Container/String.h>
+#include <charconv>
+#include <cstring>
+
+struct RunOptions
+{
+  Core::StringView<char> Suite{};
+  double                 MinSeconds{0.2};
+} Options{};
+
+int main(int argc, char** argv)
+{
+  for (int i = 1; i < argc; ++i)
+  {
+    Core::StringView<char> arg = argv[i];
+    if (arg.StartsWith("--suite="))
+    {
+      Options.Suite = arg.RemovePrefix(i32(strlen("--suite=")));
+    }
+    else if (arg.StartsWith("--min-time="))
+    {
+      arg = arg.RemovePrefix(i32(strlen("--min-time=")));
+      std::from_chars(arg.Data(), arg.Data() + arg.Size(), Options.MinSeconds);
+    }
+  }
+
+  Benchmark::BenchmarkOptions benchmarkOptions{};
+  benchmarkOptions.MinSeconds = Options.MinSeconds;
+
+  // Benchmarks are run sequentially, so they don't compete for the cores
+  for (auto* benchmark : Benchmark::Private::BenchmarkBase::GetBenchmarks())
+  {
+    if (Options.Suite.IsEmpty() || Core::StringView<char>(benchmark->SuiteName_) == Options.Suite)
+      benchmark->Run(benchmarkOptions);
+  }
+}
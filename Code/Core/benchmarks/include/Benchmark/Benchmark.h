@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Core/Container/Vector.h>
+#include <cstring>
+#include <type_traits>
+
+namespace Benchmark
+{
+struct BenchmarkOptions
+{
+  double MinSeconds{0.2}; // The iteration count doubles until a run lasts at least this long
+};
+namespace Private
+{
+class BenchmarkBase
+{
+public:
+  virtual ~BenchmarkBase() = default;
+
+  char const* SuiteName_;
+  char const* BenchmarkName_;
+
+  BenchmarkBase(char const* SuiteName, char const* BenchmarkName);
+  void Run(BenchmarkOptions const& options = BenchmarkOptions{});
+
+  static Core::Vector<BenchmarkBase*>& GetBenchmarks();
+
+protected:
+  // Executes the measured operation `Iterations` times
+  virtual void ExecuteBenchmark(i64 const Iterations) = 0;
+
+  void MarkAsSkipped(char const* reason);
+
+  // Bytes read or written by one iteration, the throughput is then reported too
+  void SetBytesPerIteration(i64 bytes);
+
+private:
+  char const* SkipReason_{};
+  i64         BytesPerIteration_{};
+};
+
+extern u64 volatile GlobalSink;
+} // namespace Private
+
+// Forces the compiler to materialize `value`, so the computation producing it can't be optimized away.
+// Small values are written to a volatile, bigger ones only have their address escape.
+template <typename T>
+inline void DoNotOptimize(T const& value)
+{
+  if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(u64))
+  {
+    u64 bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    Private::GlobalSink = bits;
+  }
+  else
+  {
+    Private::GlobalSink = u64(&value);
+  }
+}
+} // namespace Benchmark
+
+#define BENCHMARK_SUITE(Name)                      \
+  namespace Benchmark::Name::Private               \
+  {                                                \
+  constexpr char const* InternalSuiteName = #Name; \
+  }                                                \
+  namespace Benchmark::Name
+
+#define BENCHMARK(Name)                                                            \
+  class AutoRegisteringBenchmark_##Name final : Benchmark::Private::BenchmarkBase  \
+  {                                                                                \
+  public:                                                                          \
+    AutoRegisteringBenchmark_##Name()                                              \
+        : Benchmark::Private::BenchmarkBase(Private::InternalSuiteName, #Name)     \
+    {                                                                              \
+    }                                                                              \
+                                                                                   \
+  protected:                                                                       \
+    virtual void ExecuteBenchmark(i64 const Iterations) override;                  \
+  };                                                                               \
+  static AutoRegisteringBenchmark_##Name _benchmark_autoreg_##Name;                \
+  void                                   AutoRegisteringBenchmark_##Name::ExecuteBenchmark(i64 const Iterations)
+
+#define BENCHMARK_SKIP(Reason) \
+  MarkAsSkipped(Reason);       \
+  return
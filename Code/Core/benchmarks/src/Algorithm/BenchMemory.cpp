@@ -0,0 +1,122 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Algorithm/Memory.h>
+#include <Core/Container/Vector.h>
+#include <cstring>
+
+BENCHMARK_SUITE(Algorithm)
+{
+  // Source and destination of the largest copy, shared by every size
+  constexpr i64 MaxCopySize = i64(256) << 20;
+
+  Core::LargeVector<u8>& CopySource()
+  {
+    static Core::LargeVector<u8> bytes = [] {
+      Core::LargeVector<u8> result;
+      result.Resize(MaxCopySize, u8(1));
+      return result;
+    }();
+    return bytes;
+  }
+
+  Core::LargeVector<u8>& CopyDestination()
+  {
+    static Core::LargeVector<u8> bytes = [] {
+      Core::LargeVector<u8> result;
+      result.Resize(MaxCopySize, u8(0));
+      return result;
+    }();
+    return bytes;
+  }
+
+  template <i64 Size>
+  struct CopyBytes
+  {
+    static void Memcpy(i64 const iterations)
+    {
+      u8* const       to   = CopyDestination().Data();
+      u8 const* const from = CopySource().Data();
+      for (i64 i = 0; i < iterations; ++i)
+      {
+        std::memcpy(to, from, Size);
+        Benchmark::DoNotOptimize(to);
+      }
+    }
+
+    static void CopyLarge(i64 const iterations)
+    {
+      u8* const       to   = CopyDestination().Data();
+      u8 const* const from = CopySource().Data();
+      for (i64 i = 0; i < iterations; ++i)
+      {
+        Core::Algorithm::CopyLarge(to, from, Size);
+        Benchmark::DoNotOptimize(to);
+      }
+    }
+
+    static void Memset(i64 const iterations)
+    {
+      u8* const to = CopyDestination().Data();
+      for (i64 i = 0; i < iterations; ++i)
+      {
+        std::memset(to, 0, Size);
+        Benchmark::DoNotOptimize(to);
+      }
+    }
+
+    static void ZeroLarge(i64 const iterations)
+    {
+      u8* const to = CopyDestination().Data();
+      for (i64 i = 0; i < iterations; ++i)
+      {
+        Core::Algorithm::ZeroLarge(to, Size);
+        Benchmark::DoNotOptimize(to);
+      }
+    }
+  };
+
+  // Small sizes stay in the caches and go to the CRT either way, past NonTemporalThreshold the stores are streamed
+  using Copy4K   = CopyBytes<i64(4) << 10>;
+  using Copy1M   = CopyBytes<i64(1) << 20>;
+  using Copy256M = CopyBytes<i64(256) << 20>;
+
+  BENCHMARK(Memcpy_4KB)
+  {
+    SetBytesPerIteration(i64(4) << 10);
+    Copy4K::Memcpy(Iterations);
+  }
+  BENCHMARK(CopyLarge_4KB)
+  {
+    SetBytesPerIteration(i64(4) << 10);
+    Copy4K::CopyLarge(Iterations);
+  }
+  BENCHMARK(Memcpy_1MB)
+  {
+    SetBytesPerIteration(i64(1) << 20);
+    Copy1M::Memcpy(Iterations);
+  }
+  BENCHMARK(CopyLarge_1MB)
+  {
+    SetBytesPerIteration(i64(1) << 20);
+    Copy1M::CopyLarge(Iterations);
+  }
+  BENCHMARK(Memcpy_256MB)
+  {
+    SetBytesPerIteration(i64(256) << 20);
+    Copy256M::Memcpy(Iterations);
+  }
+  BENCHMARK(CopyLarge_256MB)
+  {
+    SetBytesPerIteration(i64(256) << 20);
+    Copy256M::CopyLarge(Iterations);
+  }
+  BENCHMARK(Memset_256MB)
+  {
+    SetBytesPerIteration(i64(256) << 20);
+    Copy256M::Memset(Iterations);
+  }
+  BENCHMARK(ZeroLarge_256MB)
+  {
+    SetBytesPerIteration(i64(256) << 20);
+    Copy256M::ZeroLarge(Iterations);
+  }
+}
@@ -0,0 +1,81 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Algorithm/Scan.h>
+#include <Core/Container/Vector.h>
+
+BENCHMARK_SUITE(Algorithm)
+{
+  // Per-object counts of a frame, e.g. the instances each draw emits, scanned into write offsets
+  constexpr i32 ScanCount = 100'000;
+
+  Core::Vector<u32> const& RandomCounts()
+  {
+    static Core::Vector<u32> const counts = [] {
+      Core::Vector<u32> result;
+      u32               seed = 0x9E37'79B9u;
+      for (i32 i = 0; i < ScanCount; ++i)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        result.EmplaceBack(seed & 0xFF);
+      }
+      return result;
+    }();
+    return counts;
+  }
+
+  BENCHMARK(LoopExclusiveScan_u32_100k)
+  {
+    Core::Vector<u32> const& counts = RandomCounts();
+    Core::Vector<u32>        offsets;
+    offsets.ResizeUninitialized(ScanCount);
+    for (i64 i = 0; i < Iterations; i += ScanCount)
+    {
+      u32 sum = 0;
+      for (i32 item = 0; item < ScanCount; ++item)
+      {
+        offsets[item] = sum;
+        sum += counts[item];
+      }
+      Benchmark::DoNotOptimize(offsets.Data());
+    }
+  }
+  BENCHMARK(ExclusiveScan_u32_100k)
+  {
+    Core::Vector<u32> const& counts = RandomCounts();
+    Core::Vector<u32>        offsets;
+    offsets.ResizeUninitialized(ScanCount);
+    for (i64 i = 0; i < Iterations; i += ScanCount)
+    {
+      Core::Algorithm::ExclusiveScan(Core::Span<u32 const>(counts), Core::Span<u32>(offsets));
+      Benchmark::DoNotOptimize(offsets.Data());
+    }
+  }
+  BENCHMARK(LoopCompact_u32_100k)
+  {
+    // Half the items kept at random, the worst case for a branch
+    Core::Vector<u32> const& counts = RandomCounts();
+    Core::Vector<u32>        kept;
+    for (i64 i = 0; i < Iterations; i += ScanCount)
+    {
+      kept.Clear();
+      for (u32 const count : counts)
+      {
+        if (count < 0x80)
+          kept.EmplaceBack(count);
+      }
+      Benchmark::DoNotOptimize(kept.Data());
+    }
+  }
+  BENCHMARK(Compact_u32_100k)
+  {
+    Core::Vector<u32> const& counts = RandomCounts();
+    Core::Vector<u32>        kept;
+    for (i64 i = 0; i < Iterations; i += ScanCount)
+    {
+      kept.Clear();
+      Core::Algorithm::Compact(Core::Span<u32 const>(counts), [](u32 const count) { return count < 0x80; }, kept);
+      Benchmark::DoNotOptimize(kept.Data());
+    }
+  }
+}
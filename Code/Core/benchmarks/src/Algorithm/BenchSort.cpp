@@ -0,0 +1,72 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Algorithm/Sort.h>
+#include <Core/Container/Vector.h>
+#include <algorithm>
+
+BENCHMARK_SUITE(Algorithm)
+{
+  // Frame-sized batch of 64-bit draw keys, resorted from the same shuffled copy every time
+  constexpr i32 KeyCount = 100'000;
+
+  Core::Vector<u64> const& ShuffledKeys()
+  {
+    static Core::Vector<u64> const keys = [] {
+      Core::Vector<u64> result;
+      u64               seed = 0x9E37'79B9'7F4A'7C15ull;
+      for (i32 i = 0; i < KeyCount; ++i)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        result.EmplaceBack(seed);
+      }
+      return result;
+    }();
+    return keys;
+  }
+
+  BENCHMARK(StdSort_u64_100k)
+  {
+    Core::Vector<u64> keys;
+    for (i64 i = 0; i < Iterations; i += KeyCount)
+    {
+      keys = ShuffledKeys();
+      std::sort(keys.begin(), keys.end());
+      Benchmark::DoNotOptimize(keys.Data());
+    }
+  }
+  BENCHMARK(Sort_u64_100k)
+  {
+    Core::Vector<u64> keys;
+    for (i64 i = 0; i < Iterations; i += KeyCount)
+    {
+      keys = ShuffledKeys();
+      Core::Algorithm::Sort(keys);
+      Benchmark::DoNotOptimize(keys.Data());
+    }
+  }
+  BENCHMARK(RadixSort_u64_100k)
+  {
+    Core::Vector<u64> keys;
+    for (i64 i = 0; i < Iterations; i += KeyCount)
+    {
+      keys = ShuffledKeys();
+      Core::Algorithm::RadixSort(keys);
+      Benchmark::DoNotOptimize(keys.Data());
+    }
+  }
+  BENCHMARK(RadixSort_u32Pairs_100k)
+  {
+    // Collision pairs keyed by the first body
+    Core::Vector<u32> keys;
+    Core::Vector<u32> values(KeyCount);
+    for (i64 i = 0; i < Iterations; i += KeyCount)
+    {
+      keys.Clear();
+      for (u64 const key : ShuffledKeys())
+        keys.EmplaceBack(u32(key));
+      Core::Algorithm::RadixSort(keys, values);
+      Benchmark::DoNotOptimize(values.Data());
+    }
+  }
+}
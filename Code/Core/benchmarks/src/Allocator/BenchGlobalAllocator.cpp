@@ -0,0 +1,84 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Allocator/GlobalAllocator.h>
+#include <thread>
+
+BENCHMARK_SUITE(Allocator)
+{
+  using Core::GlobalAllocator;
+  using Core::GlobalAllocatorBackend;
+
+  constexpr i32 BatchSize = 64;
+  constexpr i32 Threads   = 4;
+
+  // Allocates then frees batches of small blocks of various sizes, as containers and operator new mostly do
+  void AllocFreeSmallBlocks(GlobalAllocator& alloc, i64 const iterations)
+  {
+    void* blocks[BatchSize];
+    for (i64 i = 0; i < iterations; i += BatchSize)
+    {
+      for (i32 j = 0; j < BatchSize; ++j)
+        blocks[j] = alloc.Alloc(16 + (j * 24) % 512, 16);
+      Benchmark::DoNotOptimize(blocks);
+      for (i32 j = 0; j < BatchSize; ++j)
+        alloc.FreeSized(blocks[j], 16 + (j * 24) % 512, 16);
+    }
+  }
+
+  // Every thread runs `iterations` operations, so the result is the time per operation of one thread under contention
+  void AllocFreeSmallBlocksMultiThread(GlobalAllocator& alloc, i64 const iterations)
+  {
+    Core::Vector<std::jthread> workers(Threads);
+    for (auto& worker : workers)
+    {
+      worker = std::jthread([&alloc, iterations] {
+        GlobalAllocator::ThreadScope allocatorThread;
+        AllocFreeSmallBlocks(alloc, iterations);
+      });
+    }
+  }
+
+  GlobalAllocator HeapAllocator(GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Heap) ? GlobalAllocatorBackend::Heap : GlobalAllocatorBackend::Malloc);
+  GlobalAllocator MallocAllocator(GlobalAllocatorBackend::Malloc);
+  GlobalAllocator RpmallocAllocator(GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Rpmalloc) ? GlobalAllocatorBackend::Rpmalloc : GlobalAllocatorBackend::Malloc);
+
+  BENCHMARK(GlobalAllocator_Heap_SmallBlocks)
+  {
+    if (!GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Heap))
+    {
+      BENCHMARK_SKIP("Heap backend not available on this platform.");
+    }
+    AllocFreeSmallBlocks(HeapAllocator, Iterations);
+  }
+  BENCHMARK(GlobalAllocator_Malloc_SmallBlocks)
+  {
+    AllocFreeSmallBlocks(MallocAllocator, Iterations);
+  }
+  BENCHMARK(GlobalAllocator_Rpmalloc_SmallBlocks)
+  {
+    if (!GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Rpmalloc))
+    {
+      BENCHMARK_SKIP("Rpmalloc backend not built, enable GE_ALLOCATOR_RPMALLOC_ENABLED.");
+    }
+    AllocFreeSmallBlocks(RpmallocAllocator, Iterations);
+  }
+  BENCHMARK(GlobalAllocator_Heap_SmallBlocks_4Threads)
+  {
+    if (!GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Heap))
+    {
+      BENCHMARK_SKIP("Heap backend not available on this platform.");
+    }
+    AllocFreeSmallBlocksMultiThread(HeapAllocator, Iterations);
+  }
+  BENCHMARK(GlobalAllocator_Malloc_SmallBlocks_4Threads)
+  {
+    AllocFreeSmallBlocksMultiThread(MallocAllocator, Iterations);
+  }
+  BENCHMARK(GlobalAllocator_Rpmalloc_SmallBlocks_4Threads)
+  {
+    if (!GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Rpmalloc))
+    {
+      BENCHMARK_SKIP("Rpmalloc backend not built, enable GE_ALLOCATOR_RPMALLOC_ENABLED.");
+    }
+    AllocFreeSmallBlocksMultiThread(RpmallocAllocator, Iterations);
+  }
+}
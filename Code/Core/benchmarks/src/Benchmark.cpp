@@ -0,0 +1,64 @@
+#include <Benchmark/Benchmark.h>
+#include <chrono>
+#include <format>
+#include <iostream>
+
+namespace Benchmark::Private
+{
+u64 volatile GlobalSink = 0;
+
+BenchmarkBase::BenchmarkBase(char const* SuiteName, char const* BenchmarkName)
+    : SuiteName_(SuiteName)
+    , BenchmarkName_(BenchmarkName)
+{
+  GetBenchmarks().EmplaceBack(this);
+}
+void BenchmarkBase::Run(BenchmarkOptions const& options)
+{
+  using Clock = std::chrono::steady_clock;
+
+  // Warm-up run, also tells whether the benchmark is skipped
+  ExecuteBenchmark(1);
+  if (SkipReason_)
+  {
+    std::cout << std::format("BENCHMARK {}.{}: SKIPPED - {}\n", SuiteName_, BenchmarkName_, SkipReason_);
+    return;
+  }
+
+  i64    iterations = 1;
+  double seconds    = 0.0;
+  for (;;)
+  {
+    auto const start = Clock::now();
+    ExecuteBenchmark(iterations);
+    seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (seconds >= options.MinSeconds || iterations >= (i64(1) << 40))
+      break;
+    iterations *= 2;
+  }
+
+  double const nsPerIteration = seconds * 1e9 / double(iterations);
+  if (BytesPerIteration_ > 0)
+  {
+    double const gigabytesPerSecond = double(BytesPerIteration_) / nsPerIteration;
+    std::cout << std::format("BENCHMARK {}.{}: {:.2f} ns/op, {:.2f} GB/s ({} iterations)\n", SuiteName_, BenchmarkName_, nsPerIteration, gigabytesPerSecond, iterations);
+  }
+  else
+  {
+    std::cout << std::format("BENCHMARK {}.{}: {:.2f} ns/op ({} iterations)\n", SuiteName_, BenchmarkName_, nsPerIteration, iterations);
+  }
+}
+Core::Vector<BenchmarkBase*>& BenchmarkBase::GetBenchmarks()
+{
+  static Core::Vector<BenchmarkBase*> benchmarks;
+  return benchmarks;
+}
+void BenchmarkBase::MarkAsSkipped(char const* reason)
+{
+  SkipReason_ = reason;
+}
+void BenchmarkBase::SetBytesPerIteration(i64 const bytes)
+{
+  BytesPerIteration_ = bytes;
+}
+} // namespace Benchmark::Private
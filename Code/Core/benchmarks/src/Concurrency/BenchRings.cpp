@@ -0,0 +1,110 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Allocator/GlobalAllocator.h>
+#include <Core/Concurrency/MpscRing.h>
+#include <Core/Concurrency/SpscRing.h>
+#include <thread>
+
+BENCHMARK_SUITE(Concurrency)
+{
+  constexpr i32 RingCapacity = 4096;
+  constexpr i32 BatchSize    = 32;
+
+  // The calling thread consumes, `producers` threads share the `iterations` items.
+  // The result is the time per item going through the ring, its inverse being the ring throughput.
+  void MpscThroughput(i32 const producers, i64 const iterations)
+  {
+    Core::MpscRing<u64> ring(RingCapacity);
+    {
+      Core::Vector<std::jthread> workers(producers);
+      for (i32 p = 0; p < producers; ++p)
+      {
+        i64 const count = iterations / producers + (p < iterations % producers ? 1 : 0);
+        workers[p]      = std::jthread([&ring, count] {
+          Core::GlobalAllocator::ThreadScope allocatorThread;
+          for (i64 i = 0; i < count;)
+          {
+            if (ring.TryPush(u64(i)))
+              ++i;
+            else
+              std::this_thread::yield();
+          }
+        });
+      }
+
+      u64 batch[BatchSize];
+      for (i64 received = 0; received < iterations;)
+      {
+        i32 const popped = ring.TryPopBatch(Core::Span<u64>(batch, BatchSize));
+        if (popped == 0)
+          std::this_thread::yield();
+        received += popped;
+      }
+      Benchmark::DoNotOptimize(batch[0]);
+    }
+  }
+
+  BENCHMARK(SpscRing_1Producer)
+  {
+    Core::SpscRing<u64> ring(RingCapacity);
+    std::jthread        producer([&ring, Iterations] {
+      Core::GlobalAllocator::ThreadScope allocatorThread;
+      for (i64 i = 0; i < Iterations;)
+      {
+        if (ring.TryPush(u64(i)))
+          ++i;
+        else
+          std::this_thread::yield();
+      }
+    });
+
+    u64 batch[BatchSize];
+    for (i64 received = 0; received < Iterations;)
+    {
+      i32 const popped = ring.TryPopBatch(Core::Span<u64>(batch, BatchSize));
+      if (popped == 0)
+        std::this_thread::yield();
+      received += popped;
+    }
+    Benchmark::DoNotOptimize(batch[0]);
+  }
+  BENCHMARK(SpscRing_1Producer_Batched)
+  {
+    Core::SpscRing<u64> ring(RingCapacity);
+    std::jthread        producer([&ring, Iterations] {
+      Core::GlobalAllocator::ThreadScope allocatorThread;
+      u64                                batch[BatchSize];
+      for (i64 i = 0; i < Iterations;)
+      {
+        i64 const count = Iterations - i < BatchSize ? Iterations - i : BatchSize;
+        for (i64 j = 0; j < count; ++j)
+          batch[j] = u64(i + j);
+        i32 const pushed = ring.TryPushBatch(Core::Span<u64 const>(batch, i32(count)));
+        if (pushed == 0)
+          std::this_thread::yield();
+        i += pushed;
+      }
+    });
+
+    u64 batch[BatchSize];
+    for (i64 received = 0; received < Iterations;)
+    {
+      i32 const popped = ring.TryPopBatch(Core::Span<u64>(batch, BatchSize));
+      if (popped == 0)
+        std::this_thread::yield();
+      received += popped;
+    }
+    Benchmark::DoNotOptimize(batch[0]);
+  }
+  BENCHMARK(MpscRing_1Producer)
+  {
+    MpscThroughput(1, Iterations);
+  }
+  BENCHMARK(MpscRing_2Producers)
+  {
+    MpscThroughput(2, Iterations);
+  }
+  BENCHMARK(MpscRing_4Producers)
+  {
+    MpscThroughput(4, Iterations);
+  }
+}
@@ -0,0 +1,35 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Container/BitSet.h>
+#include <Core/Container/Vector.h>
+
+BENCHMARK_SUITE(Container)
+{
+  // Component signature workload: find the actors having a given combination of components
+  constexpr i32 SignatureCount = 100'000;
+
+  BENCHMARK(BitSet256_ContainsAll_100k)
+  {
+    Core::Vector<Core::BitSet<256>> signatures(SignatureCount);
+    u32                             seed = 1;
+    for (auto& signature : signatures)
+    {
+      for (i32 i = 0; i < 6; ++i)
+      {
+        seed = seed * 1'664'525u + 1'013'904'223u;
+        signature.Set(i32(seed >> 24) % 40);
+      }
+    }
+
+    Core::BitSet<256> wanted;
+    wanted.Set(3);
+    wanted.Set(17);
+
+    for (i64 i = 0; i < Iterations; i += SignatureCount)
+    {
+      i32 matches = 0;
+      for (auto const& signature : signatures)
+        matches += signature.ContainsAll(wanted) ? 1 : 0;
+      Benchmark::DoNotOptimize(matches);
+    }
+  }
+}
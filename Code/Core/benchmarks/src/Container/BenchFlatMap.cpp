@@ -0,0 +1,113 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Container/FlatMap.h>
+#include <algorithm>
+
+BENCHMARK_SUITE(Container)
+{
+  // Lookups of keys spread over the whole map, so large maps miss the cache like a real registry would
+  template <i32 Count, bool Indexed>
+  Core::FlatMap<u64, i32> const& GetMap()
+  {
+    static Core::FlatMap<u64, i32> const map = [] {
+      Core::FlatMap<u64, i32> m;
+      m.Reserve(Count);
+      for (i32 i = 0; i < Count; ++i)
+        m.TryEmplace(u64(i) * 2, i);
+      if constexpr (Indexed)
+        m.BuildSearchIndex();
+      return m;
+    }();
+    return map;
+  }
+
+  template <i32 Count>
+  u64 KeyAt(i64 const i)
+  {
+    return (u64(i) * 0x9E37'79B9'7F4A'7C15ull >> 20) % Count * 2;
+  }
+
+  // What Find used to do for every map size
+  template <i32 Count>
+  void BinarySearch(i64 const iterations)
+  {
+    Core::FlatMap<u64, i32> const& map = GetMap<Count, false>();
+    for (i64 i = 0; i < iterations; ++i)
+    {
+      u64 const  key = KeyAt<Count>(i);
+      u64 const* it  = std::lower_bound(map.Keys().begin(), map.Keys().end(), key);
+      Benchmark::DoNotOptimize(it != map.Keys().end() && *it == key ? map.Values().Data() + (it - map.Keys().begin()) : nullptr);
+    }
+  }
+
+  template <i32 Count, bool Indexed>
+  void Find(i64 const iterations)
+  {
+    Core::FlatMap<u64, i32> const& map = GetMap<Count, Indexed>();
+    for (i64 i = 0; i < iterations; ++i)
+      Benchmark::DoNotOptimize(map.Find(KeyAt<Count>(i)));
+  }
+  BENCHMARK(FlatMap_BinarySearch_4)
+  {
+    BinarySearch<4>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_4)
+  {
+    Find<4, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_BinarySearch_16)
+  {
+    BinarySearch<16>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_16)
+  {
+    Find<16, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_BinarySearch_256)
+  {
+    BinarySearch<256>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_256)
+  {
+    Find<256, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_FindIndexed_256)
+  {
+    Find<256, true>(Iterations);
+  }
+  BENCHMARK(FlatMap_BinarySearch_4k)
+  {
+    BinarySearch<4'096>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_4k)
+  {
+    Find<4'096, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_FindIndexed_4k)
+  {
+    Find<4'096, true>(Iterations);
+  }
+  BENCHMARK(FlatMap_BinarySearch_64k)
+  {
+    BinarySearch<65'536>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_64k)
+  {
+    Find<65'536, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_FindIndexed_64k)
+  {
+    Find<65'536, true>(Iterations);
+  }
+  BENCHMARK(FlatMap_BinarySearch_1M)
+  {
+    BinarySearch<1'048'576>(Iterations);
+  }
+  BENCHMARK(FlatMap_Find_1M)
+  {
+    Find<1'048'576, false>(Iterations);
+  }
+  BENCHMARK(FlatMap_FindIndexed_1M)
+  {
+    Find<1'048'576, true>(Iterations);
+  }
+}
@@ -0,0 +1,51 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Container/FlatMap.h>
+#include <Core/Container/HashMap.h>
+
+BENCHMARK_SUITE(Container)
+{
+  // Actor-like workload: ids inserted in increasing order, looked up, then removed
+  constexpr i32 ItemCount = 10'000;
+
+  template <typename Map>
+  void InsertFindRemove(i64 const iterations)
+  {
+    for (i64 i = 0; i < iterations; i += ItemCount)
+    {
+      Map map;
+      for (i32 id = 0; id < ItemCount; ++id)
+        map.TryEmplace(u64(id), id);
+      for (i32 id = 0; id < ItemCount; ++id)
+        Benchmark::DoNotOptimize(map.Find(u64(id)));
+      for (i32 id = 0; id < ItemCount; ++id)
+        map.TryRemove(u64(id));
+    }
+  }
+
+  template <typename Map>
+  void Find(i64 const iterations)
+  {
+    Map map;
+    for (i32 id = 0; id < ItemCount; ++id)
+      map.TryEmplace(u64(id) * 0x9E37'79B9ull, id);
+    for (i64 i = 0; i < iterations; ++i)
+      Benchmark::DoNotOptimize(map.Find(u64(i % ItemCount) * 0x9E37'79B9ull));
+  }
+
+  BENCHMARK(CompactFlatMap_InsertFindRemove_10k)
+  {
+    InsertFindRemove<Core::CompactFlatMap<u64, i32>>(Iterations);
+  }
+  BENCHMARK(HashMap_InsertFindRemove_10k)
+  {
+    InsertFindRemove<Core::HashMap<u64, i32>>(Iterations);
+  }
+  BENCHMARK(CompactFlatMap_Find_10k)
+  {
+    Find<Core::CompactFlatMap<u64, i32>>(Iterations);
+  }
+  BENCHMARK(HashMap_Find_10k)
+  {
+    Find<Core::HashMap<u64, i32>>(Iterations);
+  }
+}
@@ -0,0 +1,30 @@
+#include <Benchmark/Benchmark.h>
+#include <Core/Container/String.h>
+#include <Core/Container/Vector.h>
+
+BENCHMARK_SUITE(Container)
+{
+  // Growing from empty, so every reallocation relocates the items already in
+  constexpr i32 GrowCount = 10'000;
+
+  BENCHMARK(Vector_GrowStrings_10k)
+  {
+    for (i64 i = 0; i < Iterations; i += GrowCount)
+    {
+      Core::Vector<Core::String<char>> v;
+      for (i32 j = 0; j < GrowCount; ++j)
+        v.EmplaceBack("a string long enough to live on the heap");
+      Benchmark::DoNotOptimize(v.Data());
+    }
+  }
+  BENCHMARK(Vector_GrowNestedVectors_10k)
+  {
+    for (i64 i = 0; i < Iterations; i += GrowCount)
+    {
+      Core::Vector<Core::Vector<i32>> v;
+      for (i32 j = 0; j < GrowCount; ++j)
+        v.EmplaceBack(4, j);
+      Benchmark::DoNotOptimize(v.Data());
+    }
+  }
+}
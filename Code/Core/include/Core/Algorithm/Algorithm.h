@@ -13,13 +13,15 @@ namespace Private
 template <std::input_iterator InputIterator, typename OutputIterator>
 __declspec(noalias) void FastCopy(InputIterator fromStart, InputIterator fromEnd, OutputIterator to)
 {
+  u64 const size          = (fromEnd - fromStart) * sizeof(*fromStart);
   u64 const fromStartAddr = (u64)fromStart;
   u64 const fromEndAddr   = (u64)fromEnd;
   u64 const toAddr        = (u64)to;
-  if (fromStartAddr <= toAddr && toAddr <= fromEndAddr)
-    std::memmove(to, fromStart, (fromEnd - fromStart) * sizeof(*fromStart));
+  // The ranges overlap whichever comes first, memcpy is only valid when they're disjoint
+  if (toAddr < fromEndAddr && fromStartAddr < toAddr + size)
+    std::memmove(to, fromStart, size);
   else
-    std::memcpy(to, fromStart, (fromEnd - fromStart) * sizeof(*fromStart));
+    std::memcpy(to, fromStart, size);
 }
 
 template <std::input_iterator InputIterator, typename OutputIterator>
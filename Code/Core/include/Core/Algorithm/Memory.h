@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Core/API.h>
+#include <Core/Container/Span.h>
+#include <Core/Definitions.h>
+
+namespace Core::Algorithm
+{
+// From this size, CopyLarge, FillLarge and ZeroLarge write with non-temporal stores, which bypass the caches:
+// the buffer would evict most of them anyway. Smaller sizes go to the CRT.
+inline constexpr i64 NonTemporalThreshold = i64(4) << 20;
+
+// memmove for big buffers, e.g. uploads or snapshots. The ranges may overlap, overlapping copies go to memmove.
+// The kernel, AVX-512, AVX2 or SSE2 streaming stores, is picked from the CPU features on first use.
+// GE_LARGE_MEMORY_KERNEL=AVX-512|AVX2|SSE2|CRT forces a supported one, e.g. to compare them.
+CORE_API void CopyLarge(void* to, void const* from, i64 const size);
+
+// memset for big buffers.
+CORE_API void FillLarge(void* to, u8 const value, i64 const size);
+
+CORE_API void ZeroLarge(void* to, i64 const size);
+
+namespace Private
+{
+using LargeCopyFn = void (*)(u8* to, u8 const* from, i64 size);
+using LargeFillFn = void (*)(u8* to, u8 value, i64 size);
+
+// Kernels of CopyLarge and FillLarge, they expect at least NonTemporalThreshold bytes and disjoint ranges.
+struct LargeMemoryKernels
+{
+  char const* Name_;
+  LargeCopyFn Copy_;
+  LargeFillFn Fill_;
+};
+
+// The kernels this CPU supports, fastest first, the CRT one last. Lets the tests check each of them.
+CORE_API Span<LargeMemoryKernels const> SupportedLargeMemoryKernels();
+} // namespace Private
+} // namespace Core::Algorithm
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Core/Definitions.h>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Core
+{
+// True when moving a T to another address and forgetting the original is the same as copying its bytes,
+// i.e. T holds no pointer into itself and nothing else tracks its address.
+// Automatic for trivially copyable types, other types opt in with a specialization next to their definition:
+//   template <typename T>
+//   inline constexpr bool IsTriviallyRelocatable<MyContainer<T>> = true;
+template <typename T>
+inline constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
+namespace Algorithm
+{
+// Moves [from, fromEnd) to the uninitialized, non-overlapping memory at `to`, the source is left uninitialized.
+template <typename T>
+void Relocate(T* from, T* fromEnd, T* to)
+{
+  if constexpr (IsTriviallyRelocatable<T>)
+  {
+    if (from != fromEnd)
+      std::memcpy((void*)to, (void const*)from, u64(fromEnd - from) * sizeof(T));
+  }
+  else
+  {
+    for (; from != fromEnd; ++from, ++to)
+    {
+      new (to) T(std::move(*from));
+      from->~T();
+    }
+  }
+}
+} // namespace Algorithm
+} // namespace Core
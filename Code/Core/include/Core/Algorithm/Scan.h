@@ -0,0 +1,329 @@
+#pragma once
+
+#include <Core/Assert/Assert.h>
+#include <Core/Concurrency/TaskPool.h>
+#include <Core/Container/Span.h>
+#include <Core/Container/Vector.h>
+#include <Core/Definitions.h>
+#include <Core/Platform/Cpu.h>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+namespace Core::Algorithm
+{
+namespace Private
+{
+// Below this many items per task, splitting the work costs more than it saves.
+inline constexpr i32 ScanMinItemsPerTask = 1 << 15;
+
+// Integers whose scans have an AVX2 kernel, the others run the scalar loop.
+// The kernels are picked at runtime, when the CPU has AVX2.
+template <typename T>
+concept ScanSimdType = std::integral<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+#if GE_CPU_X64
+template <typename T>
+GE_TARGET("avx2") __m256i Broadcast(T const value)
+{
+  if constexpr (sizeof(T) == 4)
+    return _mm256_set1_epi32((i32)value);
+  else
+    return _mm256_set1_epi64x((i64)value);
+}
+
+// Inclusive scan of the vector `x` plus `sum`, which holds the running total in every lane and is updated.
+// Log-step scan inside each 128-bit half, then the total of the low half is added to the high half.
+template <typename T>
+GE_TARGET("avx2") __m256i ScanVector(__m256i x, __m256i& sum)
+{
+  if constexpr (sizeof(T) == 4)
+  {
+    x                = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+    x                = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+    __m256i const lo = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(3));
+    x                = _mm256_add_epi32(x, _mm256_blend_epi32(_mm256_setzero_si256(), lo, 0xF0));
+    x                = _mm256_add_epi32(x, sum);
+    sum              = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+  }
+  else
+  {
+    x                = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+    __m256i const lo = _mm256_permute4x64_epi64(x, 0x55);
+    x                = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_setzero_si256(), lo, 0xF0));
+    x                = _mm256_add_epi64(x, sum);
+    sum              = _mm256_permute4x64_epi64(x, 0xFF);
+  }
+  return x;
+}
+
+template <typename T>
+GE_TARGET("avx2") T FirstLane(__m256i const x)
+{
+  if constexpr (sizeof(T) == 4)
+    return (T)_mm256_cvtsi256_si32(x);
+  else
+    return (T)_mm_cvtsi128_si64(_mm256_castsi256_si128(x));
+}
+
+// The whole vectors of InclusiveScanKernel and ExclusiveScanKernel, returns how many items were scanned.
+template <bool Inclusive, typename T>
+GE_TARGET("avx2") i32 ScanAvx2(T const* items, T* out, i32 const count, T& carry)
+{
+  constexpr i32 lanes = 32 / (i32)sizeof(T);
+  __m256i       sum   = Broadcast(carry);
+  i32           i     = 0;
+  for (; i + lanes <= count; i += lanes)
+  {
+    __m256i const x         = _mm256_loadu_si256((__m256i const*)(items + i));
+    __m256i const inclusive = ScanVector<T>(x, sum);
+    if constexpr (Inclusive)
+      _mm256_storeu_si256((__m256i*)(out + i), inclusive);
+    // The inclusive scan minus the item, which keeps in-place scans working
+    else if constexpr (sizeof(T) == 4)
+      _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi32(inclusive, x));
+    else
+      _mm256_storeu_si256((__m256i*)(out + i), _mm256_sub_epi64(inclusive, x));
+  }
+  carry = FirstLane<T>(sum);
+  _mm256_zeroupper();
+  return i;
+}
+#endif
+
+// Writes the inclusive scan of `count` items to `out`, which may alias `items`, starting from `carry`.
+// Returns the running total.
+template <typename T>
+T InclusiveScanKernel(T const* items, T* out, i32 const count, T carry)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if constexpr (ScanSimdType<T>)
+  {
+    if (HasAvx2())
+      i = ScanAvx2<true>(items, out, count, carry);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    carry += items[i];
+    out[i] = carry;
+  }
+  return carry;
+}
+
+// Same as InclusiveScanKernel, each output excluding its own item.
+template <typename T>
+T ExclusiveScanKernel(T const* items, T* out, i32 const count, T carry)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if constexpr (ScanSimdType<T>)
+  {
+    if (HasAvx2())
+      i = ScanAvx2<false>(items, out, count, carry);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    T const item = items[i];
+    out[i]       = carry;
+    carry += item;
+  }
+  return carry;
+}
+
+template <typename T>
+T Sum(T const* items, i32 const count)
+{
+  T sum = T();
+  for (i32 i = 0; i < count; ++i)
+    sum += items[i];
+  return sum;
+}
+
+// Chunked scan: the chunk totals are summed in parallel, scanned serially, then every chunk is scanned from its
+// offset in parallel. Reads the items twice, so it only pays off with enough threads and items.
+template <bool Inclusive, typename T>
+T ParallelScan(T const* items, T* out, i32 const count, T const init, ITaskPool* pool)
+{
+  i32 const concurrency = pool ? pool->Concurrency() : 1;
+  i32 const maxTasks    = count / ScanMinItemsPerTask;
+  i32 const chunkCount  = maxTasks < concurrency ? maxTasks : concurrency;
+  if (chunkCount < 2)
+    return Inclusive ? InclusiveScanKernel(items, out, count, init) : ExclusiveScanKernel(items, out, count, init);
+
+  auto chunkBegin = [&](i32 const chunk) { return i32((i64)count * chunk / chunkCount); };
+
+  Vector<T> offsets(chunkCount);
+  pool->ParallelFor(chunkCount, [&](i32 const chunk) {
+    offsets[chunk] = Sum(items + chunkBegin(chunk), chunkBegin(chunk + 1) - chunkBegin(chunk));
+  });
+  T const total = ExclusiveScanKernel(offsets.Data(), offsets.Data(), chunkCount, init);
+
+  pool->ParallelFor(chunkCount, [&](i32 const chunk) {
+    i32 const begin = chunkBegin(chunk);
+    i32 const end   = chunkBegin(chunk + 1);
+    if constexpr (Inclusive)
+      InclusiveScanKernel(items + begin, out + begin, end - begin, offsets[chunk]);
+    else
+      ExclusiveScanKernel(items + begin, out + begin, end - begin, offsets[chunk]);
+  });
+  return total;
+}
+
+// Items moved by a single AVX2 permutation.
+template <typename T>
+concept CompactSimdType = std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8);
+
+#if GE_CPU_X64
+// For every mask of kept items, the 32-bit lanes to gather so the kept items end up packed at the front.
+template <i32 ItemSize>
+constexpr auto MakeCompactPermutations()
+{
+  constexpr i32 items        = 32 / ItemSize;
+  constexpr i32 lanesPerItem = ItemSize / 4;
+
+  std::array<std::array<i32, 8>, 1 << items> table{};
+  for (i32 mask = 0; mask < (1 << items); ++mask)
+  {
+    i32 lane = 0;
+    for (i32 item = 0; item < items; ++item)
+    {
+      if (mask & (1 << item))
+      {
+        for (i32 part = 0; part < lanesPerItem; ++part)
+          table[mask][lane++] = item * lanesPerItem + part;
+      }
+    }
+  }
+  return table;
+}
+
+template <i32 ItemSize>
+inline constexpr auto CompactPermutations = MakeCompactPermutations<ItemSize>();
+
+// The whole vectors of CompactKernel, returns how many items were read and adds the kept ones to `written`.
+template <typename T, typename Predicate>
+GE_TARGET("avx2") i32 CompactAvx2(T const* items, i32 const count, Predicate& keep, T* out, i32 const outLimit, i32& written)
+{
+  constexpr i32 lanes = 32 / (i32)sizeof(T);
+  i32           i     = 0;
+  for (; i + lanes <= count && written + lanes <= outLimit; i += lanes)
+  {
+    u32 mask = 0;
+    for (i32 lane = 0; lane < lanes; ++lane)
+      mask |= u32(keep(items[i + lane]) ? 1 : 0) << lane;
+
+    __m256i const permutation = _mm256_loadu_si256((__m256i const*)CompactPermutations<(i32)sizeof(T)>[mask].data());
+    __m256i const packed      = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i const*)(items + i)), permutation);
+    _mm256_storeu_si256((__m256i*)(out + written), packed);
+    written += std::popcount(mask);
+  }
+  _mm256_zeroupper();
+  return i;
+}
+#endif
+
+// Packs the items passing `keep` at `out`, writing at most `outLimit` items there, and returns how many were kept.
+// Items are written unconditionally then the output only advances when kept, so there's no unpredictable branch.
+// The AVX2 path stores a whole vector each time, so it stops a vector short of `outLimit`.
+template <typename T, typename Predicate>
+i32 CompactKernel(T const* items, i32 const count, Predicate& keep, T* out, i32 const outLimit)
+{
+  i32 i       = 0;
+  i32 written = 0;
+#if GE_CPU_X64
+  if constexpr (CompactSimdType<T>)
+  {
+    if (HasAvx2())
+      i = CompactAvx2(items, count, keep, out, outLimit, written);
+  }
+#endif
+  for (; i < count && written < outLimit; ++i)
+  {
+    out[written] = items[i];
+    written += keep(items[i]) ? 1 : 0;
+  }
+  return written;
+}
+
+template <typename T, typename Predicate>
+i32 Count(T const* items, i32 const count, Predicate& keep)
+{
+  i32 kept = 0;
+  for (i32 i = 0; i < count; ++i)
+    kept += keep(items[i]) ? 1 : 0;
+  return kept;
+}
+} // namespace Private
+
+// out[i] = items[0] + ... + items[i]. `out` may be `items`, and returns the total.
+template <typename T, typename U>
+  requires std::same_as<std::remove_const_t<T>, U>
+U InclusiveScan(Span<T> items, Span<U> out, ITaskPool* pool = nullptr)
+{
+  checkf(out.Size() >= items.Size(), "InclusiveScan output is too small.");
+  return Private::ParallelScan<true>(items.Data(), out.Data(), items.Size(), U(), pool);
+}
+
+// out[i] = init + items[0] + ... + items[i - 1], e.g. the write offsets of variable-sized outputs.
+// `out` may be `items`, and returns the total.
+template <typename T, typename U>
+  requires std::same_as<std::remove_const_t<T>, U>
+U ExclusiveScan(Span<T> items, Span<U> out, U const init = U(), ITaskPool* pool = nullptr)
+{
+  checkf(out.Size() >= items.Size(), "ExclusiveScan output is too small.");
+  return Private::ParallelScan<false>(items.Data(), out.Data(), items.Size(), init, pool);
+}
+
+// Appends the items passing `keep(item)` to `out`, in order, and returns how many were appended.
+// `out` grows once, to its size plus the items, so the filter runs without per-item growth checks.
+// With a pool, the items are cut in chunks which are counted, then compacted, in parallel: `keep` runs twice
+// per item and shall be thread safe.
+template <typename T, typename Predicate, typename SizeT, typename Growth>
+i32 Compact(Span<T> items, Predicate keep, Vector<std::remove_const_t<T>, SizeT, Growth>& out, ITaskPool* pool = nullptr)
+{
+  using Item = std::remove_const_t<T>;
+  static_assert(std::is_trivially_copyable_v<Item> && std::is_trivially_default_constructible_v<Item>,
+                "Compact writes the items bytewise into uninitialized memory.");
+
+  i32 const   count    = items.Size();
+  SizeT const base     = out.Size();
+  // The AVX2 kernel stores whole vectors, a few items past the last kept one
+  SizeT const capacity = base + count + 32 / (i32)sizeof(Item);
+  out.Reserve(capacity);
+
+  i32 const concurrency = pool ? pool->Concurrency() : 1;
+  i32 const maxTasks    = count / Private::ScanMinItemsPerTask;
+  i32 const chunkCount  = maxTasks < concurrency ? maxTasks : concurrency;
+  i32       kept        = 0;
+  if (chunkCount < 2)
+  {
+    kept = Private::CompactKernel(items.Data(), count, keep, out.Data() + base, i32(capacity - base));
+  }
+  else
+  {
+    auto chunkBegin = [&](i32 const chunk) { return i32((i64)count * chunk / chunkCount); };
+
+    // Chunks only write their exact output range, as the next chunk's range is written at the same time
+    Vector<i32> offsets(chunkCount);
+    pool->ParallelFor(chunkCount, [&](i32 const chunk) {
+      offsets[chunk] = Private::Count(items.Data() + chunkBegin(chunk), chunkBegin(chunk + 1) - chunkBegin(chunk), keep);
+    });
+    kept = Private::ExclusiveScanKernel(offsets.Data(), offsets.Data(), chunkCount, 0);
+
+    Item* const outItems = out.Data() + base;
+    pool->ParallelFor(chunkCount, [&](i32 const chunk) {
+      i32 const begin = chunkBegin(chunk);
+      i32 const end   = chunkBegin(chunk + 1);
+      i32 const limit = (chunk + 1 < chunkCount ? offsets[chunk + 1] : kept) - offsets[chunk];
+      Private::CompactKernel(items.Data() + begin, end - begin, keep, outItems + offsets[chunk], limit);
+    });
+  }
+
+  out.ResizeUninitialized(base + kept);
+  return kept;
+}
+} // namespace Core::Algorithm
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Concurrency/TaskPool.h>
+#include <Core/Container/Span.h>
+#include <Core/Container/Vector.h>
+#include <Core/Definitions.h>
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// Pattern-defeating quicksort, vendored by Tracy
+#include <tracy_pdqsort.h>
+
+namespace Core::Algorithm
+{
+// Unstable comparison sort: pdqsort, O(n log n) worst case and linear on already sorted or reversed input.
+// Arithmetic items compared with the default std::less<T> use the branchless partitioning.
+template <typename T, typename Compare = std::less<std::remove_const_t<T>>>
+void Sort(Span<T> items, Compare comp = Compare())
+{
+  tracy::pdqsort(items.begin(), items.end(), comp);
+}
+
+template <typename T, typename SizeT, typename Growth, typename Compare = std::less<T>>
+void Sort(Vector<T, SizeT, Growth>& items, Compare comp = Compare())
+{
+  tracy::pdqsort(items.begin(), items.end(), comp);
+}
+
+namespace Private
+{
+template <typename Key>
+concept RadixKey = std::same_as<Key, u32> || std::same_as<Key, u64>;
+
+inline constexpr i32 RadixDigitBits  = 8;
+inline constexpr i32 RadixDigitCount = 1 << RadixDigitBits;
+
+// LSD radix sort of `count` keys and optional values (Value = void for keys only), 8 bits per pass.
+// The histograms of every digit are built in a single read of the keys, and the passes where all the keys share
+// the same digit are skipped, e.g. the high bytes of small keys. The result ends up in `keys` and `values`.
+template <RadixKey Key, typename Value>
+void RadixSortImpl(Key* keys, Value* values, i64 const count, IAllocator* scratchAllocator)
+{
+  constexpr i32  passCount = (i32)sizeof(Key);
+  constexpr bool hasValues = !std::is_void_v<Value>;
+
+  if (count < 2)
+    return;
+
+  i64 histograms[passCount][RadixDigitCount] = {};
+  for (i64 i = 0; i < count; ++i)
+  {
+    Key const key = keys[i];
+    for (i32 pass = 0; pass < passCount; ++pass)
+      ++histograms[pass][(key >> (pass * RadixDigitBits)) & (RadixDigitCount - 1)];
+  }
+
+  LargeVector<Key> keyScratch(scratchAllocator);
+  keyScratch.ResizeUninitialized(count);
+  Key* srcKeys = keys;
+  Key* dstKeys = keyScratch.Data();
+
+  using ValueStorage = std::conditional_t<hasValues, Value, u8>;
+  LargeVector<ValueStorage> valueScratch(scratchAllocator);
+  ValueStorage*             srcValues = nullptr;
+  ValueStorage*             dstValues = nullptr;
+  if constexpr (hasValues)
+  {
+    valueScratch.ResizeUninitialized(count);
+    srcValues = values;
+    dstValues = valueScratch.Data();
+  }
+
+  for (i32 pass = 0; pass < passCount; ++pass)
+  {
+    i64*      histogram = histograms[pass];
+    i32 const shift     = pass * RadixDigitBits;
+    if (histogram[(srcKeys[0] >> shift) & (RadixDigitCount - 1)] == count)
+      continue;
+
+    // Exclusive prefix sum, the histogram now holds where each digit is written next
+    i64 offset = 0;
+    for (i32 digit = 0; digit < RadixDigitCount; ++digit)
+    {
+      i64 const digitCount = histogram[digit];
+      histogram[digit]     = offset;
+      offset += digitCount;
+    }
+
+    for (i64 i = 0; i < count; ++i)
+    {
+      i64 const to = histogram[(srcKeys[i] >> shift) & (RadixDigitCount - 1)]++;
+      dstKeys[to]  = srcKeys[i];
+      if constexpr (hasValues)
+        dstValues[to] = srcValues[i];
+    }
+    std::swap(srcKeys, dstKeys);
+    if constexpr (hasValues)
+      std::swap(srcValues, dstValues);
+  }
+
+  if (srcKeys != keys)
+  {
+    std::memcpy(keys, srcKeys, (u64)count * sizeof(Key));
+    if constexpr (hasValues)
+      std::memcpy(values, srcValues, (u64)count * sizeof(Value));
+  }
+}
+} // namespace Private
+
+// Stable sort of u32 or u64 keys in ascending order, in O(n) with sizeof(Key) passes at most.
+// Beats Sort past a few hundred keys, e.g. for 64-bit draw keys.
+template <Private::RadixKey Key>
+void RadixSort(Span<Key> keys, IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  Private::RadixSortImpl<Key, void>(keys.Data(), nullptr, keys.Size(), scratchAllocator);
+}
+
+template <Private::RadixKey Key, typename SizeT, typename Growth>
+void RadixSort(Vector<Key, SizeT, Growth>& keys, IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  Private::RadixSortImpl<Key, void>(keys.Data(), nullptr, keys.Size(), scratchAllocator);
+}
+
+// Same as RadixSort(keys), `values[i]` moving along with `keys[i]`. Values are copied bytewise.
+template <Private::RadixKey Key, typename Value>
+void RadixSort(Span<Key> keys, Span<Value> values, IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  static_assert(std::is_trivially_copyable_v<Value>, "RadixSort values shall be trivially copyable.");
+  checkf(keys.Size() == values.Size(), "RadixSort needs one value per key.");
+  Private::RadixSortImpl<Key, Value>(keys.Data(), values.Data(), keys.Size(), scratchAllocator);
+}
+
+template <Private::RadixKey Key, typename Value, typename SizeT, typename Growth>
+void RadixSort(Vector<Key, SizeT, Growth>& keys, Vector<Value, SizeT, Growth>& values, IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  static_assert(std::is_trivially_copyable_v<Value>, "RadixSort values shall be trivially copyable.");
+  checkf(keys.Size() == values.Size(), "RadixSort needs one value per key.");
+  Private::RadixSortImpl<Key, Value>(keys.Data(), values.Data(), keys.Size(), scratchAllocator);
+}
+
+namespace Private
+{
+// Below this many items per task, splitting the work costs more than it saves.
+inline constexpr i64 ParallelSortMinItemsPerTask = 1 << 14;
+
+// Merge path: how many items of `a` come first among the first `diagonal` items of the stable merge of `a` and `b`.
+template <typename T, typename Compare>
+i64 MergePathSplit(T const* a, i64 const countA, T const* b, i64 const countB, i64 const diagonal, Compare& comp)
+{
+  i64 low  = diagonal > countB ? diagonal - countB : 0;
+  i64 high = diagonal < countA ? diagonal : countA;
+  while (low < high)
+  {
+    i64 const i = low + (high - low) / 2;
+    if (comp(b[diagonal - i - 1], a[i]))
+      high = i;
+    else
+      low = i + 1;
+  }
+  return low;
+}
+
+template <typename T, typename Compare>
+void ParallelSortImpl(T* items, i64 const count, Compare& comp, ITaskPool* pool, IAllocator* scratchAllocator)
+{
+  i32 const concurrency = pool ? pool->Concurrency() : 1;
+  i64 const maxTasks    = count / ParallelSortMinItemsPerTask;
+  i32 const runCount    = i32(maxTasks < concurrency ? maxTasks : concurrency);
+  if (runCount < 2)
+  {
+    tracy::pdqsort(items, items + count, comp);
+    return;
+  }
+
+  // Sorted runs, run r being [bounds[r], bounds[r + 1])
+  Vector<i64> bounds(runCount + 1);
+  for (i32 run = 0; run <= runCount; ++run)
+    bounds[run] = count * run / runCount;
+
+  pool->ParallelFor(runCount, [&](i32 const run) { tracy::pdqsort(items + bounds[run], items + bounds[run + 1], comp); });
+
+  // Merges pairs of runs back and forth between the items and the scratch buffer, until a single run is left.
+  // Each merge is cut into pieces along its merge path, so the last rounds keep every thread busy.
+  LargeVector<T> scratch(scratchAllocator);
+  if constexpr (std::is_trivially_default_constructible_v<T>)
+    scratch.ResizeUninitialized(count);
+  else
+    scratch.Resize(count);
+  T*          src = items;
+  T*          dst = scratch.Data();
+  Vector<i64> nextBounds;
+  while (bounds.Size() > 2)
+  {
+    i32 const runs      = bounds.Size() - 1;
+    i32 const merges    = (runs + 1) / 2;
+    i32 const piecesPer = concurrency / merges > 1 ? concurrency / merges : 1;
+
+    pool->ParallelFor(merges * piecesPer, [&](i32 const task) {
+      i32 const merge = task / piecesPer;
+      i32 const piece = task % piecesPer;
+      i64 const begin = bounds[2 * merge];
+      i64 const mid   = bounds[2 * merge + 1];
+      i64 const end   = 2 * merge + 2 <= runs ? bounds[2 * merge + 2] : mid;
+
+      T const*  a      = src + begin;
+      T const*  b      = src + mid;
+      i64 const countA = mid - begin;
+      i64 const countB = end - mid;
+      i64 const total  = countA + countB;
+
+      i64 const firstDiagonal = total * piece / piecesPer;
+      i64 const lastDiagonal  = total * (piece + 1) / piecesPer;
+      i64 const firstA        = MergePathSplit(a, countA, b, countB, firstDiagonal, comp);
+      i64 const lastA         = MergePathSplit(a, countA, b, countB, lastDiagonal, comp);
+      std::merge(std::make_move_iterator(src + begin + firstA),
+                 std::make_move_iterator(src + begin + lastA),
+                 std::make_move_iterator(src + mid + firstDiagonal - firstA),
+                 std::make_move_iterator(src + mid + lastDiagonal - lastA),
+                 dst + begin + firstDiagonal,
+                 comp);
+    });
+
+    nextBounds.Clear();
+    for (i32 run = 0; run < runs; run += 2)
+      nextBounds.EmplaceBack(bounds[run]);
+    nextBounds.EmplaceBack(count);
+    bounds.Swap(nextBounds);
+    std::swap(src, dst);
+  }
+
+  if (src != items)
+  {
+    pool->ParallelFor(runCount, [&](i32 const task) {
+      i64 const begin = count * task / runCount;
+      i64 const end   = count * (task + 1) / runCount;
+      std::move(src + begin, src + end, items + begin);
+    });
+  }
+}
+} // namespace Private
+
+// Merge sort spreading the work on `pool`: the items are cut in one run per thread, sorted with pdqsort, then merged
+// pairwise with every merge split along its merge path. Small inputs, or no pool, fall back to Sort.
+// Needs a scratch buffer as big as the items, T shall be default constructible.
+template <typename T, typename Compare = std::less<T>>
+void ParallelSort(Span<T> items, ITaskPool* pool, Compare comp = Compare(), IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  Private::ParallelSortImpl(items.Data(), items.Size(), comp, pool, scratchAllocator);
+}
+
+template <typename T, typename SizeT, typename Growth, typename Compare = std::less<T>>
+void ParallelSort(Vector<T, SizeT, Growth>& items, ITaskPool* pool, Compare comp = Compare(), IAllocator* scratchAllocator = GetGlobalAllocator())
+{
+  Private::ParallelSortImpl(items.Data(), (i64)items.Size(), comp, pool, scratchAllocator);
+}
+} // namespace Core::Algorithm
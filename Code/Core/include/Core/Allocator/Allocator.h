@@ -5,6 +5,12 @@
 
 namespace Core
 {
+enum class AllocFlags : u32
+{
+  Uninitialized = 0,      // The content of the block is unspecified
+  Zeroed        = 1 << 0, // Every byte of the block is set to 0
+};
+
 // Interface used by all the containers in the std.
 // Instead of being type-intrusive, as it literally changes the container type,
 // we pay the price of storing 1 pointer to an allocator
@@ -14,12 +20,14 @@ public:
   virtual ~IAllocator() = default;
 
   // Allocates a contiguous block of memory with at least `size` capacity.
+  // Unless AllocFlags::Zeroed is requested, the memory is left uninitialized.
   // Returns:
   //   success, a valid pointer
   //   fail, nullptr
-  __declspec(allocator) __declspec(restrict) virtual void* Alloc(i64 const size, i32 const alignment) = 0;
+  __declspec(allocator) __declspec(restrict) virtual void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) = 0;
 
   // Reallocates a contiguous block of memory with at least `size` capacity.
+  // The grown part of the block is left uninitialized.
   // Returns:
   //   success, a valid pointer == p (Realloc never moves the memory block, always expands/shrinks it)
   //   fail, nullptr
@@ -29,6 +37,22 @@ public:
   // WARNING: `p` shall be the exact same pointer returned by Alloc()
   __declspec(noalias) virtual void Free(void* p, i32 const alignment) = 0;
 
+  // Same as Realloc(), with the current size of the block known by the caller.
+  // Size-class allocators can use it to find the block's class without a lookup or a per-block header.
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) virtual void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+  {
+    (void)oldSize;
+    return Realloc(p, size, alignment);
+  }
+
+  // Same as Free(), with the size passed to Alloc() (or to the last successful Realloc()).
+  // WARNING: `size` shall be exact, allocators are allowed to trust it blindly.
+  __declspec(noalias) virtual void FreeSized(void* p, i64 const size, i32 const alignment)
+  {
+    (void)size;
+    Free(p, alignment);
+  }
+
   // If the allocator is also "moved into" the new container when a move operation is performed.
   // WARNING: if this is false, a copy will be made.
   virtual bool IsMovable() = 0;
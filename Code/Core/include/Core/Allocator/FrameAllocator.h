@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+
+namespace Core
+{
+// Double-buffered linear allocator for transient, per-frame memory.
+// Allocations are a pointer bump inside the current block, Free is a no-op (except for the last allocation),
+// and everything is released at once by BeginFrame().
+// Memory allocated during frame N stays valid until the end of frame N+1, so data can be handed over to the next frame.
+// When a block is exhausted a new one is chained, and on reset the chain is collapsed into a single block
+// big enough to hold the high-water mark, so steady-state frames never touch the parent allocator.
+// WARNING: not thread-safe, it shall be used only by the thread calling BeginFrame().
+class CORE_API FrameAllocator final : public IAllocator
+{
+public:
+  inline static constexpr i64 DefaultBlockSize = 1'024 * 1'024;
+
+  struct Stats
+  {
+    i64 UsedBytes_{};     // Bytes handed out during the current frame, alignment padding included
+    i64 HighWaterMark_{}; // Maximum UsedBytes_ ever reached by a single frame
+    i32 BlockCount_{};    // Blocks currently chained in the active buffer
+    i32 OverflowCount_{}; // How many times a block had to be chained, since construction
+  };
+
+  explicit FrameAllocator(i64 const blockSize = DefaultBlockSize, IAllocator* parent = GetGlobalAllocator());
+  ~FrameAllocator() override;
+
+  FrameAllocator(FrameAllocator const&)            = delete;
+  FrameAllocator& operator=(FrameAllocator const&) = delete;
+
+  // Swaps the buffers and resets the one that becomes active.
+  // Shall be called once per frame, before any transient allocation.
+  void BeginFrame();
+
+  Stats GetStats() const;
+
+  // clang-format off
+  // Inherited via IAllocator
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void Free(void* p, i32 const alignment) override;
+  bool IsMovable() override;
+  bool IsCopyable() override;
+  bool OwnedByContainer() override;
+  //clang-format on
+
+private:
+  struct Block;
+
+  struct Buffer
+  {
+    Block* First_{};
+    Block* Current_{};
+    u8*    Cursor_{};
+    u8*    Top_{}; // Start of the last allocation, used to grow/shrink it in-place
+    i64    Used_{};
+  };
+
+  IAllocator* Parent_;
+  i64         BlockSize_;
+  Buffer      Buffers_[2];
+  i32         Active_;
+  i64         HighWaterMark_;
+  i32         OverflowCount_;
+
+  Block* AllocBlock(i64 const capacity);
+  void   ResetBuffer(Buffer& buffer);
+  void   ReleaseBuffer(Buffer& buffer);
+};
+
+// Frame allocator of the engine thread, reset by Engine::GameEngine::Tick.
+CORE_API FrameAllocator* GetFrameAllocator();
+} // namespace Core
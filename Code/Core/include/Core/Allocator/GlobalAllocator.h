@@ -4,19 +4,65 @@
 
 namespace Core
 {
+// Implementation behind the global allocator (and therefore behind operator new/delete).
+enum class GlobalAllocatorBackend : u8
+{
+  Heap,     // Win32 process heap, Windows only
+  Malloc,   // CRT malloc/aligned_alloc, portable
+  Rpmalloc, // Thread-caching rpmalloc vendored by Tracy, requires GE_ALLOCATOR_RPMALLOC_ENABLED
+  Count,
+};
+
+// The backend is chosen once, at the first allocation of the process:
+// the GE_GLOBAL_ALLOCATOR environment variable ("heap", "malloc" or "rpmalloc") if set and available,
+// otherwise rpmalloc when built in, otherwise the platform default (heap on Windows, malloc elsewhere).
+// Thread-caching backends keep a heap per thread, so every thread allocating through it shall be wrapped in a ThreadScope.
 class CORE_API GlobalAllocator final : public IAllocator
 {
 public:
+  // Per-thread initialization/finalization hooks of the backend, to be put at the top of a thread function.
+  // Finalization gives the thread caches back, without it they are leaked when the thread exits.
+  class ThreadScope
+  {
+  public:
+    ThreadScope()
+    {
+      ThreadInitialize();
+    }
+    ~ThreadScope()
+    {
+      ThreadFinalize();
+    }
+
+    ThreadScope(ThreadScope const&)            = delete;
+    ThreadScope& operator=(ThreadScope const&) = delete;
+  };
+
+  // Any backend can be instantiated, as long as memory is freed by the backend which allocated it.
+  explicit GlobalAllocator(GlobalAllocatorBackend const backend);
+
   static GlobalAllocator& GetInstance();
 
+  static bool        IsBackendAvailable(GlobalAllocatorBackend const backend);
+  static char const* GetBackendName(GlobalAllocatorBackend const backend);
+
+  static void ThreadInitialize();
+  static void ThreadFinalize();
+
+  GlobalAllocatorBackend GetBackend() const;
+
   // clang-format off
   // Inherited via IAllocator
-  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment) override;
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override;
   __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override;
   __declspec(noalias) void Free(void* p, i32 const alignment) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment) override;
   bool IsMovable() override;
   bool IsCopyable() override;
   bool OwnedByContainer() override;
   //clang-format on
+
+private:
+  GlobalAllocatorBackend Backend_;
 };
 } // namespace Core
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Core
+{
+// Fixed-size allocator, every allocation takes exactly one slot of `Size` bytes.
+// Slots are carved out of pages of `PageSize` bytes requested to the parent allocator,
+// freed slots are kept in an intrusive free list, so both Alloc and Free are O(1)
+// and objects of the same kind end up packed in the same pages.
+// Pages are only released when the pool is destroyed.
+// WARNING: not thread-safe.
+template <i32 Size, i32 Alignment = alignof(void*), i32 PageSize = 64 * 1'024>
+class PoolAllocator : public IAllocator
+{
+  static_assert(Size > 0, "Size shall be positive.");
+  static_assert(std::has_single_bit(u32(Alignment)), "Alignment shall be a power of 2.");
+
+  struct FreeSlot
+  {
+    FreeSlot* Next_;
+  };
+
+  struct Page
+  {
+    Page* Next_;
+  };
+
+  constexpr static i32 AlignUp(i32 const value, i32 const alignment)
+  {
+    return (value + alignment - 1) & ~(alignment - 1);
+  }
+
+public:
+  inline static constexpr i32 SlotAlignment = std::max(Alignment, (i32)alignof(FreeSlot));
+  inline static constexpr i32 SlotSize      = AlignUp(std::max(Size, (i32)sizeof(FreeSlot)), SlotAlignment);
+  inline static constexpr i32 HeaderSize    = AlignUp((i32)sizeof(Page), SlotAlignment);
+  inline static constexpr i32 SlotsPerPage  = std::max(1, (PageSize - HeaderSize) / SlotSize);
+
+private:
+  IAllocator* Parent_;
+  Page*       Pages_     = nullptr;
+  FreeSlot*   FreeList_  = nullptr;
+  u8*         Cursor_    = nullptr; // Next never-used slot of the newest page
+  u8*         End_       = nullptr;
+  i32         PageCount_ = 0;
+  i32         LiveCount_ = 0;
+
+  bool AllocPage()
+  {
+    auto* page = (Page*)Parent_->Alloc(HeaderSize + (i64)SlotsPerPage * SlotSize, SlotAlignment);
+    checkf(page, "Couldn't allocate PoolAllocator page.");
+    if (!page)
+      return false;
+
+    page->Next_ = Pages_;
+    Pages_      = page;
+    Cursor_     = (u8*)page + HeaderSize;
+    End_        = Cursor_ + (i64)SlotsPerPage * SlotSize;
+    ++PageCount_;
+    return true;
+  }
+
+public:
+  explicit PoolAllocator(IAllocator* parent = GetGlobalAllocator())
+      : Parent_(parent)
+  {
+    checkf(parent, "Invalid parent allocator!");
+  }
+
+  PoolAllocator(PoolAllocator const&)            = delete;
+  PoolAllocator& operator=(PoolAllocator const&) = delete;
+
+  ~PoolAllocator() override
+  {
+    while (Pages_)
+    {
+      Page* next = Pages_->Next_;
+      Parent_->Free(Pages_, SlotAlignment);
+      Pages_ = next;
+    }
+  }
+
+  // Number of slots currently in use.
+  i32 LiveCount() const
+  {
+    return LiveCount_;
+  }
+
+  i32 PageCount() const
+  {
+    return PageCount_;
+  }
+
+  __declspec(allocator) __declspec(restrict) virtual void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override
+  {
+    checkf(size <= Size, "PoolAllocator can't allocate more than %d bytes.", Size);
+    checkf(alignment <= SlotAlignment, "PoolAllocator can't overalign a pointer.");
+    if (size > Size || alignment > SlotAlignment)
+      return nullptr;
+
+    void* p;
+    if (FreeList_)
+    {
+      p         = FreeList_;
+      FreeList_ = FreeList_->Next_;
+    }
+    else
+    {
+      if (Cursor_ == End_ && !AllocPage())
+        return nullptr;
+      p        = Cursor_;
+      Cursor_ += SlotSize;
+    }
+    ++LiveCount_;
+    if (flags == AllocFlags::Zeroed)
+      std::memset(p, 0, (u64)size);
+    return p;
+  }
+
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) virtual void* Realloc(void* p, i64 const size, i32 const alignment) override
+  {
+    return p && size <= Size && alignment <= SlotAlignment ? p : nullptr;
+  }
+
+  __declspec(noalias) virtual void Free(void* p, i32 const alignment) override
+  {
+    (void)alignment;
+    if (p)
+    {
+      checkf(LiveCount_ > 0, "PoolAllocator Free called more times than Alloc.");
+      auto* slot  = (FreeSlot*)p;
+      slot->Next_ = FreeList_;
+      FreeList_   = slot;
+      --LiveCount_;
+    }
+  }
+
+  __declspec(noalias) virtual void FreeSized(void* p, i64 const size, i32 const alignment) override
+  {
+    // All the slots have the same size, nothing to look up
+    checkf(size <= Size, "PoolAllocator FreeSized called with a block bigger than a slot.");
+    Free(p, alignment);
+  }
+
+  bool IsMovable() override
+  {
+    return true;
+  }
+  bool IsCopyable() override
+  {
+    return true;
+  }
+  bool OwnedByContainer() override
+  {
+    return false;
+  }
+};
+} // namespace Core
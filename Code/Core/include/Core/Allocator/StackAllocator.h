@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+
+namespace Core
+{
+// Linear allocator over a single buffer, meant for scoped scratch memory.
+// Allocations are a pointer bump, the last one can be grown/shrunk in-place,
+// and everything allocated after a Marker is released at once by Rewind().
+// When the buffer is full, allocations are forwarded to the parent allocator,
+// those must be freed normally as Rewind() only reclaims the buffer.
+// Zero-size allocations return nullptr.
+// WARNING: not thread-safe.
+class CORE_API StackAllocator : public IAllocator
+{
+public:
+  struct Marker
+  {
+    u8* Cursor_;
+    u8* Last_;
+  };
+
+  // Rewinds the allocator when going out of scope.
+  class ScopedMarker
+  {
+    StackAllocator& Allocator_;
+    Marker const    Marker_;
+
+  public:
+    explicit ScopedMarker(StackAllocator& allocator)
+        : Allocator_(allocator)
+        , Marker_(allocator.GetMarker())
+    {
+    }
+    ScopedMarker(ScopedMarker const&)            = delete;
+    ScopedMarker& operator=(ScopedMarker const&) = delete;
+    ~ScopedMarker()
+    {
+      Allocator_.Rewind(Marker_);
+    }
+  };
+
+  // Uses a buffer of `capacity` bytes requested to the parent allocator.
+  explicit StackAllocator(i64 const capacity, IAllocator* parent = GetGlobalAllocator());
+
+  // Uses an external buffer, which shall outlive the allocator.
+  StackAllocator(void* buffer, i64 const capacity, IAllocator* parent = GetGlobalAllocator());
+
+  StackAllocator(StackAllocator const&)            = delete;
+  StackAllocator& operator=(StackAllocator const&) = delete;
+
+  ~StackAllocator() override;
+
+  Marker GetMarker() const;
+
+  // Releases everything allocated from the buffer after `marker` was taken.
+  void Rewind(Marker const marker);
+
+  // Releases everything allocated from the buffer.
+  void Reset();
+
+  i64 Used() const;
+  i64 Capacity() const;
+
+  // If `p` points inside the buffer, otherwise it was allocated by the parent.
+  bool Owns(void const* p) const;
+
+  // clang-format off
+  // Inherited via IAllocator
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void Free(void* p, i32 const alignment) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void FreeSized(void* p, i64 const size, i32 const alignment) override;
+  bool IsMovable() override;
+  bool IsCopyable() override;
+  bool OwnedByContainer() override;
+  //clang-format on
+
+private:
+  IAllocator* Parent_;
+  u8*         Begin_;
+  u8*         End_;
+  u8*         Cursor_;
+  u8*         Last_; // Start of the last allocation, the only one that can be resized
+  bool        OwnsBuffer_;
+};
+
+// StackAllocator with an inline buffer of `Bytes` bytes, ie. for scratch memory on the stack.
+template <i32 Bytes, i32 Alignment = 16>
+class InlineStackAllocator final : public StackAllocator
+{
+  static_assert(Bytes > 0, "Bytes shall be positive.");
+  static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment shall be a power of 2.");
+
+  alignas(Alignment) u8 Mem_[Bytes];
+
+public:
+  explicit InlineStackAllocator(IAllocator* parent = GetGlobalAllocator())
+      : StackAllocator(Mem_, Bytes, parent)
+  {
+  }
+};
+} // namespace Core
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <atomic>
+
+namespace Core
+{
+// Subsystem an allocation is attributed to.
+enum class MemoryTag : u8
+{
+  Untagged,
+  Core,
+  Engine,
+  ECS,
+  Renderer,
+  Physics,
+  Input,
+  Logging,
+  Reflection,
+  Count,
+};
+
+CORE_API char const* GetMemoryTagName(MemoryTag const tag);
+
+// Tag used by the allocations of the calling thread, when the allocator doesn't force one.
+CORE_API MemoryTag GetCurrentMemoryTag();
+CORE_API void      SetCurrentMemoryTag(MemoryTag const tag);
+
+// Sets the tag of the calling thread for the lifetime of the object, then restores the previous one.
+class ScopedMemoryTag
+{
+public:
+  explicit ScopedMemoryTag(MemoryTag const tag)
+      : Previous_(GetCurrentMemoryTag())
+  {
+    SetCurrentMemoryTag(tag);
+  }
+  ~ScopedMemoryTag()
+  {
+    SetCurrentMemoryTag(Previous_);
+  }
+
+  ScopedMemoryTag(ScopedMemoryTag const&)            = delete;
+  ScopedMemoryTag& operator=(ScopedMemoryTag const&) = delete;
+
+private:
+  MemoryTag Previous_;
+};
+
+// Decorator attributing every allocation of the wrapped allocator to a memory tag.
+// The tag is either fixed at construction or, when Untagged, the one of the calling thread at Alloc() time.
+// Each block is prefixed by a small header holding its size and tag, so Realloc/Free are accounted to the same tag.
+// The inner allocator always receives sized Realloc/Free, as the header knows the size.
+// Counters are atomic, the allocator is as thread-safe as the wrapped one.
+// When GE_PROFILING_ENABLED, every event is also reported to Tracy as a named memory pool (one per tag).
+class CORE_API TrackingAllocator final : public IAllocator
+{
+public:
+  // Buckets are power-of-2 size classes: [0, 16], (16, 32], ..., (128K, 256K], (256K, inf)
+  inline static constexpr i32 HistogramBuckets = 16;
+
+  struct Stats
+  {
+    i64 LiveBytes_{};   // Bytes currently allocated, headers excluded
+    i64 PeakBytes_{};   // Maximum LiveBytes_ ever reached
+    i64 LiveCount_{};   // Allocations currently alive
+    i64 AllocCount_{};  // Allocations made since construction
+    i64 Histogram_[HistogramBuckets]{};
+  };
+
+  explicit TrackingAllocator(IAllocator* inner = GetGlobalAllocator(), MemoryTag const tag = MemoryTag::Untagged);
+
+  TrackingAllocator(TrackingAllocator const&)            = delete;
+  TrackingAllocator& operator=(TrackingAllocator const&) = delete;
+
+  Stats GetStats(MemoryTag const tag) const;
+  Stats GetTotalStats() const;
+
+  static i32 GetHistogramBucket(i64 const size);
+
+  // clang-format off
+  // Inherited via IAllocator
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void Free(void* p, i32 const alignment) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void FreeSized(void* p, i64 const size, i32 const alignment) override;
+  bool IsMovable() override;
+  bool IsCopyable() override;
+  bool OwnedByContainer() override;
+  //clang-format on
+
+private:
+  struct Counters
+  {
+    std::atomic<i64> LiveBytes_{};
+    std::atomic<i64> PeakBytes_{};
+    std::atomic<i64> LiveCount_{};
+    std::atomic<i64> AllocCount_{};
+    std::atomic<i64> Histogram_[HistogramBuckets]{};
+  };
+
+  IAllocator* Inner_;
+  MemoryTag   Tag_;
+  Counters    Counters_[(i32)MemoryTag::Count];
+
+  void OnAlloc(MemoryTag const tag, i64 const size);
+  void OnResize(MemoryTag const tag, i64 const oldSize, i64 const newSize);
+  void OnFree(MemoryTag const tag, i64 const size);
+};
+
+// Tracking allocator over the global allocator, used by operator new/delete when GE_MEMORY_TRACKING_ENABLED.
+CORE_API TrackingAllocator* GetTrackingAllocator();
+} // namespace Core
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+
+namespace Core
+{
+// Linear allocator over a reserved range of address space, physical pages are committed on demand.
+// As nothing else lives after the last allocation, it can always grow in-place up to the reserved size,
+// so a container using this allocator never copies its elements when it grows.
+// Best used with one big container per allocator (component arrays, asset blobs, etc.).
+// WARNING: not thread-safe.
+class CORE_API VirtualArenaAllocator final : public IAllocator
+{
+public:
+  inline static constexpr i64 DefaultReserveSize = 8ll * 1'024 * 1'024 * 1'024;
+  inline static constexpr i64 CommitGranularity  = 64 * 1'024;
+
+  explicit VirtualArenaAllocator(i64 const reserveSize = DefaultReserveSize);
+  ~VirtualArenaAllocator() override;
+
+  VirtualArenaAllocator(VirtualArenaAllocator const&)            = delete;
+  VirtualArenaAllocator& operator=(VirtualArenaAllocator const&) = delete;
+
+  // Releases every allocation and decommits all the pages.
+  void Reset();
+
+  i64 Used() const;
+  i64 Committed() const;
+  i64 Reserved() const;
+
+  // clang-format off
+  // Inherited via IAllocator
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override;
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override;
+  __declspec(noalias) void Free(void* p, i32 const alignment) override;
+  bool IsMovable() override;
+  bool IsCopyable() override;
+  bool OwnedByContainer() override;
+  //clang-format on
+
+private:
+  u8* Begin_;
+  u8* Cursor_;
+  u8* Last_; // Start of the last allocation, the only one that can be resized
+  u8* CommitEnd_;
+  u8* ReserveEnd_;
+
+  // Makes sure [Begin_, end) is committed.
+  bool EnsureCommitted(u8* end);
+
+  // Decommits the pages after the cursor.
+  void Trim();
+};
+} // namespace Core
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Core/Definitions.h>
+
+namespace Core
+{
+// Destructive interference size of the supported targets.
+// Data written by different threads is kept this far apart, so the threads don't invalidate each other's cache lines.
+inline constexpr i32 CacheLineSize = 64;
+} // namespace Core
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Concurrency/CacheLine.h>
+#include <Core/Container/Span.h>
+#include <Core/Definitions.h>
+#include <atomic>
+#include <bit>
+#include <new>
+#include <utility>
+
+namespace Core
+{
+#pragma warning(push)
+#pragma warning(disable : 4'324) // structure was padded due to alignment specifier, the sides get their own cache line
+// Bounded lock-free queue for any number of producer threads and exactly one consumer thread.
+// Every cell carries a sequence number telling which lap it's ready for: producers claim positions
+// with a CAS on the tail, then publish the cell through its sequence, so a slow producer never
+// exposes a half-written item to the consumer, which simply waits for that cell.
+template <typename T>
+class MpscRing
+{
+  struct Cell
+  {
+    std::atomic<u64> Sequence_; // == position: free for it, == position + 1: holds its item
+    alignas(T) u8 Storage_[sizeof(T)];
+
+    T* Item()
+    {
+      return (T*)Storage_;
+    }
+  };
+
+  inline static constexpr i32 MemAlignment = alignof(Cell) > CacheLineSize ? i32(alignof(Cell)) : CacheLineSize;
+
+  // Consumer side
+  alignas(CacheLineSize) std::atomic<u64> Head_;
+
+  // Shared by the producers
+  alignas(CacheLineSize) std::atomic<u64> Tail_;
+
+  // Read-only once constructed
+  alignas(CacheLineSize) IAllocator* Allocator_;
+  Cell* Cells_;
+  u64   Mask_;
+
+  // Claims up to `wanted` consecutive free positions, returns how many were claimed from `position`.
+  u64 Claim(u64 const wanted, u64& position)
+  {
+    position = Tail_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      u64 free = 0;
+      while (free < wanted && Cells_[(position + free) & Mask_].Sequence_.load(std::memory_order_acquire) == position + free)
+        ++free;
+
+      if (free == 0)
+      {
+        // Either full, or another producer moved the tail meanwhile
+        u64 const current = Tail_.load(std::memory_order_relaxed);
+        if (current == position)
+          return 0;
+        position = current;
+        continue;
+      }
+
+      if (Tail_.compare_exchange_weak(position, position + free, std::memory_order_relaxed))
+        return free;
+    }
+  }
+
+public:
+  // `capacity` is rounded up to a power of two.
+  explicit MpscRing(i32 const capacity, IAllocator* allocator = GetGlobalAllocator())
+      : Head_(0)
+      , Tail_(0)
+      , Allocator_(allocator)
+      , Mask_(std::bit_ceil(u64(capacity)) - 1)
+  {
+    checkf(allocator, "Invalid allocator!");
+    checkf(capacity > 0, "MpscRing capacity shall be positive.");
+    Cells_ = (Cell*)Allocator_->Alloc(i64((Mask_ + 1) * sizeof(Cell)), MemAlignment);
+    checkf(Cells_, "Couldn't allocate MpscRing memory.");
+    for (u64 i = 0; i <= Mask_; ++i)
+      new (&Cells_[i].Sequence_) std::atomic<u64>(i);
+  }
+
+  MpscRing(MpscRing const&)            = delete;
+  MpscRing& operator=(MpscRing const&) = delete;
+
+  ~MpscRing()
+  {
+    u64 const tail = Tail_.load(std::memory_order_relaxed);
+    for (u64 head = Head_.load(std::memory_order_relaxed); head != tail; ++head)
+      Cells_[head & Mask_].Item()->~T();
+    Allocator_->FreeSized(Cells_, i64((Mask_ + 1) * sizeof(Cell)), MemAlignment);
+    if (Allocator_->OwnedByContainer())
+      delete Allocator_;
+  }
+
+  // Any thread. Returns false if the ring is full.
+  template <typename... Args>
+  bool TryEmplace(Args&&... args)
+  {
+    u64 position;
+    if (Claim(1, position) == 0)
+      return false;
+
+    Cell& cell = Cells_[position & Mask_];
+    new (cell.Item()) T(std::forward<Args>(args)...);
+    cell.Sequence_.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPush(T const& value)
+  {
+    return TryEmplace(value);
+  }
+
+  bool TryPush(T&& value)
+  {
+    return TryEmplace(std::move(value));
+  }
+
+  // Any thread. Claims as many consecutive slots as fit with a single CAS, returns how many items were pushed.
+  i32 TryPushBatch(Span<T const> const items)
+  {
+    if (items.IsEmpty())
+      return 0;
+
+    u64       position;
+    i32 const count = i32(Claim(u64(items.Size()), position));
+    for (i32 i = 0; i < count; ++i)
+    {
+      Cell& cell = Cells_[(position + u64(i)) & Mask_];
+      new (cell.Item()) T(items[i]);
+      cell.Sequence_.store(position + u64(i) + 1, std::memory_order_release);
+    }
+    return count;
+  }
+
+  // Consumer only. Returns false if the ring is empty, or if the next item is still being written.
+  bool TryPop(T& out)
+  {
+    u64 const head = Head_.load(std::memory_order_relaxed);
+    Cell&     cell = Cells_[head & Mask_];
+    if (cell.Sequence_.load(std::memory_order_acquire) != head + 1)
+      return false;
+
+    out = std::move(*cell.Item());
+    cell.Item()->~T();
+    cell.Sequence_.store(head + Mask_ + 1, std::memory_order_release);
+    Head_.store(head + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Consumer only. Pops up to `out.Size()` items, returns how many were popped.
+  i32 TryPopBatch(Span<T> out)
+  {
+    i32 count = 0;
+    while (count < out.Size() && TryPop(out[count]))
+      ++count;
+    return count;
+  }
+
+  // Approximation when called while other threads are running.
+  i32 Size() const
+  {
+    u64 const head = Head_.load(std::memory_order_acquire);
+    u64 const tail = Tail_.load(std::memory_order_acquire);
+    return tail > head ? i32(tail - head) : 0;
+  }
+
+  bool IsEmpty() const
+  {
+    return Size() == 0;
+  }
+
+  i32 Capacity() const
+  {
+    return i32(Mask_ + 1);
+  }
+};
+#pragma warning(pop)
+} // namespace Core
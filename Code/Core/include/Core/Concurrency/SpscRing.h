@@ -0,0 +1,176 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Concurrency/CacheLine.h>
+#include <Core/Container/Span.h>
+#include <Core/Definitions.h>
+#include <atomic>
+#include <bit>
+#include <new>
+#include <utility>
+
+namespace Core
+{
+#pragma warning(push)
+#pragma warning(disable : 4'324) // structure was padded due to alignment specifier, the sides get their own cache line
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// Each side caches the last position it read from the other one, so the shared counters are only
+// touched when the ring looks full (producer) or empty (consumer).
+template <typename T>
+class SpscRing
+{
+  inline static constexpr i32 MemAlignment = alignof(T) > CacheLineSize ? i32(alignof(T)) : CacheLineSize;
+
+  // Consumer side
+  alignas(CacheLineSize) std::atomic<u64> Head_;
+  u64 CachedTail_;
+
+  // Producer side
+  alignas(CacheLineSize) std::atomic<u64> Tail_;
+  u64 CachedHead_;
+
+  // Read-only once constructed
+  alignas(CacheLineSize) IAllocator* Allocator_;
+  T*  Mem_;
+  u64 Mask_;
+
+  // Number of free slots from `tail`, refreshing the cached head only if needed.
+  u64 FreeSlots(u64 const tail, u64 const wanted)
+  {
+    u64 const capacity = Mask_ + 1;
+    u64       free     = capacity - (tail - CachedHead_);
+    if (free < wanted)
+    {
+      CachedHead_ = Head_.load(std::memory_order_acquire);
+      free        = capacity - (tail - CachedHead_);
+    }
+    return free;
+  }
+
+  // Number of readable slots from `head`, refreshing the cached tail only if needed.
+  u64 ReadableSlots(u64 const head, u64 const wanted)
+  {
+    u64 readable = CachedTail_ - head;
+    if (readable < wanted)
+    {
+      CachedTail_ = Tail_.load(std::memory_order_acquire);
+      readable    = CachedTail_ - head;
+    }
+    return readable;
+  }
+
+public:
+  // `capacity` is rounded up to a power of two.
+  explicit SpscRing(i32 const capacity, IAllocator* allocator = GetGlobalAllocator())
+      : Head_(0)
+      , CachedTail_(0)
+      , Tail_(0)
+      , CachedHead_(0)
+      , Allocator_(allocator)
+      , Mask_(std::bit_ceil(u64(capacity)) - 1)
+  {
+    checkf(allocator, "Invalid allocator!");
+    checkf(capacity > 0, "SpscRing capacity shall be positive.");
+    Mem_ = (T*)Allocator_->Alloc(i64((Mask_ + 1) * sizeof(T)), MemAlignment);
+    checkf(Mem_, "Couldn't allocate SpscRing memory.");
+  }
+
+  SpscRing(SpscRing const&)            = delete;
+  SpscRing& operator=(SpscRing const&) = delete;
+
+  ~SpscRing()
+  {
+    u64 const tail = Tail_.load(std::memory_order_relaxed);
+    for (u64 head = Head_.load(std::memory_order_relaxed); head != tail; ++head)
+      Mem_[head & Mask_].~T();
+    Allocator_->FreeSized(Mem_, i64((Mask_ + 1) * sizeof(T)), MemAlignment);
+    if (Allocator_->OwnedByContainer())
+      delete Allocator_;
+  }
+
+  // Producer only. Returns false if the ring is full.
+  template <typename... Args>
+  bool TryEmplace(Args&&... args)
+  {
+    u64 const tail = Tail_.load(std::memory_order_relaxed);
+    if (FreeSlots(tail, 1) == 0)
+      return false;
+
+    new (Mem_ + (tail & Mask_)) T(std::forward<Args>(args)...);
+    Tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPush(T const& value)
+  {
+    return TryEmplace(value);
+  }
+
+  bool TryPush(T&& value)
+  {
+    return TryEmplace(std::move(value));
+  }
+
+  // Producer only. Pushes as many items as fit, publishing them at once, and returns how many were pushed.
+  i32 TryPushBatch(Span<T const> const items)
+  {
+    u64 const tail  = Tail_.load(std::memory_order_relaxed);
+    u64 const free  = FreeSlots(tail, u64(items.Size()));
+    i32 const count = free < u64(items.Size()) ? i32(free) : items.Size();
+    for (i32 i = 0; i < count; ++i)
+      new (Mem_ + ((tail + u64(i)) & Mask_)) T(items[i]);
+    Tail_.store(tail + u64(count), std::memory_order_release);
+    return count;
+  }
+
+  // Consumer only. Returns false if the ring is empty.
+  bool TryPop(T& out)
+  {
+    u64 const head = Head_.load(std::memory_order_relaxed);
+    if (ReadableSlots(head, 1) == 0)
+      return false;
+
+    T* item = Mem_ + (head & Mask_);
+    out     = std::move(*item);
+    item->~T();
+    Head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only. Pops up to `out.Size()` items, releasing their slots at once, and returns how many were popped.
+  i32 TryPopBatch(Span<T> out)
+  {
+    u64 const head     = Head_.load(std::memory_order_relaxed);
+    u64 const readable = ReadableSlots(head, u64(out.Size()));
+    i32 const count    = readable < u64(out.Size()) ? i32(readable) : out.Size();
+    for (i32 i = 0; i < count; ++i)
+    {
+      T* item = Mem_ + ((head + u64(i)) & Mask_);
+      out[i]  = std::move(*item);
+      item->~T();
+    }
+    Head_.store(head + u64(count), std::memory_order_release);
+    return count;
+  }
+
+  // Approximation when called while the other side is running.
+  i32 Size() const
+  {
+    u64 const head = Head_.load(std::memory_order_acquire);
+    u64 const tail = Tail_.load(std::memory_order_acquire);
+    return i32(tail - head);
+  }
+
+  bool IsEmpty() const
+  {
+    return Size() == 0;
+  }
+
+  i32 Capacity() const
+  {
+    return i32(Mask_ + 1);
+  }
+};
+#pragma warning(pop)
+} // namespace Core
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Core/API.h>
+#include <Core/Definitions.h>
+#include <functional>
+
+namespace Core
+{
+// Runs batches of independent tasks on worker threads.
+// Core doesn't own any thread, the job system of the application implements it and hands it to the algorithms.
+class CORE_API ITaskPool
+{
+public:
+  virtual ~ITaskPool() = default;
+
+  // How many tasks can run at the same time, the calling thread included.
+  virtual i32 Concurrency() = 0;
+
+  // Runs `task(i)` for every i in [0, count), in any order and on any thread, and returns once all of them are done.
+  // The calling thread may run some of them.
+  virtual void ParallelFor(i32 const count, std::function<void(i32)> const& task) = 0;
+};
+} // namespace Core
@@ -0,0 +1,488 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Container/Span.h>
+#include <Core/Container/Vector.h>
+#include <Core/Definitions.h>
+#include <Core/Platform/Cpu.h>
+#include <bit>
+
+namespace Core
+{
+namespace Private
+{
+// Word kernels shared by BitSet and DynamicBitSet, `count` is in 64-bit words.
+// When the CPU has AVX2, large sets process 4 words per instruction. MSVC's std::popcount and std::countr_zero check
+// for POPCNT and TZCNT at runtime, GCC and Clang use them when the target has them.
+#if GE_CPU_X64
+// The AVX2 kernels only process the whole vectors, the callers finish the last words.
+enum class BitWordsOp
+{
+  And,
+  Or,
+  AndNot,
+};
+
+template <BitWordsOp Op>
+GE_TARGET("avx2") void BitWordsApplyAvx2(u64* dst, u64 const* src, i32 const count)
+{
+  for (i32 i = 0; i + 4 <= count; i += 4)
+  {
+    __m256i const d = _mm256_loadu_si256((__m256i const*)(dst + i));
+    __m256i const s = _mm256_loadu_si256((__m256i const*)(src + i));
+    if constexpr (Op == BitWordsOp::And)
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_and_si256(d, s));
+    else if constexpr (Op == BitWordsOp::Or)
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_or_si256(d, s));
+    else
+      _mm256_storeu_si256((__m256i*)(dst + i), _mm256_andnot_si256(s, d));
+  }
+  _mm256_zeroupper();
+}
+
+// False if a bit of `b` isn't in `a`.
+GE_TARGET("avx2") inline bool BitWordsContainsAllAvx2(u64 const* a, u64 const* b, i32 const count)
+{
+  bool contained = true;
+  for (i32 i = 0; contained && i + 4 <= count; i += 4)
+    contained = _mm256_testc_si256(_mm256_loadu_si256((__m256i const*)(a + i)), _mm256_loadu_si256((__m256i const*)(b + i)));
+  _mm256_zeroupper();
+  return contained;
+}
+
+GE_TARGET("avx2") inline bool BitWordsIntersectsAvx2(u64 const* a, u64 const* b, i32 const count)
+{
+  bool intersects = false;
+  for (i32 i = 0; !intersects && i + 4 <= count; i += 4)
+    intersects = !_mm256_testz_si256(_mm256_loadu_si256((__m256i const*)(a + i)), _mm256_loadu_si256((__m256i const*)(b + i)));
+  _mm256_zeroupper();
+  return intersects;
+}
+
+// Below 8 words, e.g. a 256 bits BitSet, the inlined scalar loop beats the call to the AVX2 kernel.
+inline bool BitWordsUseAvx2(i32 const count)
+{
+  return count >= 8 && HasAvx2();
+}
+#endif
+
+inline void BitWordsAnd(u64* dst, u64 const* src, i32 const count)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if (BitWordsUseAvx2(count))
+  {
+    BitWordsApplyAvx2<BitWordsOp::And>(dst, src, count);
+    i = count & ~3;
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] &= src[i];
+}
+
+inline void BitWordsOr(u64* dst, u64 const* src, i32 const count)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if (BitWordsUseAvx2(count))
+  {
+    BitWordsApplyAvx2<BitWordsOp::Or>(dst, src, count);
+    i = count & ~3;
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] |= src[i];
+}
+
+inline void BitWordsAndNot(u64* dst, u64 const* src, i32 const count)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if (BitWordsUseAvx2(count))
+  {
+    BitWordsApplyAvx2<BitWordsOp::AndNot>(dst, src, count);
+    i = count & ~3;
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] &= ~src[i];
+}
+
+// True if every bit set in `b` is also set in `a`.
+inline bool BitWordsContainsAll(u64 const* a, u64 const* b, i32 const count)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if (BitWordsUseAvx2(count))
+  {
+    if (!BitWordsContainsAllAvx2(a, b, count))
+      return false;
+    i = count & ~3;
+  }
+#endif
+  for (; i < count; ++i)
+    if (b[i] & ~a[i])
+      return false;
+  return true;
+}
+
+inline bool BitWordsIntersects(u64 const* a, u64 const* b, i32 const count)
+{
+  i32 i = 0;
+#if GE_CPU_X64
+  if (BitWordsUseAvx2(count))
+  {
+    if (BitWordsIntersectsAvx2(a, b, count))
+      return true;
+    i = count & ~3;
+  }
+#endif
+  for (; i < count; ++i)
+    if (a[i] & b[i])
+      return true;
+  return false;
+}
+
+inline bool BitWordsAny(u64 const* words, i32 const count)
+{
+  return BitWordsIntersects(words, words, count);
+}
+
+inline bool BitWordsEqual(u64 const* a, u64 const* b, i32 const count)
+{
+  for (i32 i = 0; i < count; ++i)
+    if (a[i] != b[i])
+      return false;
+  return true;
+}
+
+inline i32 BitWordsCount(u64 const* words, i32 const count)
+{
+  i32 bits = 0;
+  for (i32 i = 0; i < count; ++i)
+    bits += std::popcount(words[i]);
+  return bits;
+}
+
+// First set bit at or after `from`, -1 if there is none.
+inline i32 BitWordsFindNextSet(u64 const* words, i32 const count, i32 const from)
+{
+  i32 word = from >> 6;
+  if (word >= count)
+    return -1;
+
+  u64 bits = words[word] & (~0ull << (from & 63));
+  while (bits == 0)
+  {
+    if (++word == count)
+      return -1;
+    bits = words[word];
+  }
+  return word * 64 + std::countr_zero(bits);
+}
+
+// Mask of the valid bits of the last word for a set of `bits` bits.
+constexpr u64 BitWordsTailMask(i32 const bits)
+{
+  return bits % 64 == 0 ? ~0ull : (1ull << (bits % 64)) - 1;
+}
+} // namespace Private
+
+// Fixed-size set of bits, stored inline.
+template <i32 Bits>
+class BitSet
+{
+  static_assert(Bits > 0, "BitSet size shall be positive.");
+
+public:
+  inline static constexpr i32 WordCount = (Bits + 63) / 64;
+
+private:
+  u64 Words_[WordCount]{};
+
+public:
+  constexpr BitSet() = default;
+
+  constexpr bool Test(i32 const bit) const
+  {
+    checkf(bit >= 0 && bit < Bits, "BitSet index out of range.");
+    return (Words_[bit >> 6] >> (bit & 63)) & 1;
+  }
+
+  constexpr void Set(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Bits, "BitSet index out of range.");
+    Words_[bit >> 6] |= 1ull << (bit & 63);
+  }
+
+  constexpr void Reset(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Bits, "BitSet index out of range.");
+    Words_[bit >> 6] &= ~(1ull << (bit & 63));
+  }
+
+  constexpr void Flip(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Bits, "BitSet index out of range.");
+    Words_[bit >> 6] ^= 1ull << (bit & 63);
+  }
+
+  constexpr void SetAll()
+  {
+    for (u64& word : Words_)
+      word = ~0ull;
+    Words_[WordCount - 1] = Private::BitWordsTailMask(Bits);
+  }
+
+  constexpr void Reset()
+  {
+    for (u64& word : Words_)
+      word = 0;
+  }
+
+  i32 Count() const
+  {
+    return Private::BitWordsCount(Words_, WordCount);
+  }
+
+  bool Any() const
+  {
+    return Private::BitWordsAny(Words_, WordCount);
+  }
+
+  bool None() const
+  {
+    return !Any();
+  }
+
+  // True if every bit set in `other` is also set here.
+  bool ContainsAll(BitSet const& other) const
+  {
+    return Private::BitWordsContainsAll(Words_, other.Words_, WordCount);
+  }
+
+  bool Intersects(BitSet const& other) const
+  {
+    return Private::BitWordsIntersects(Words_, other.Words_, WordCount);
+  }
+
+  // -1 if there is no set bit at or after `from`.
+  i32 FindNextSet(i32 const from) const
+  {
+    return from >= Bits ? -1 : Private::BitWordsFindNextSet(Words_, WordCount, from);
+  }
+
+  i32 FindFirstSet() const
+  {
+    return FindNextSet(0);
+  }
+
+  BitSet& operator&=(BitSet const& other)
+  {
+    Private::BitWordsAnd(Words_, other.Words_, WordCount);
+    return *this;
+  }
+
+  BitSet& operator|=(BitSet const& other)
+  {
+    Private::BitWordsOr(Words_, other.Words_, WordCount);
+    return *this;
+  }
+
+  // Clears the bits set in `other`.
+  BitSet& AndNot(BitSet const& other)
+  {
+    Private::BitWordsAndNot(Words_, other.Words_, WordCount);
+    return *this;
+  }
+
+  friend BitSet operator&(BitSet lhs, BitSet const& rhs)
+  {
+    return lhs &= rhs;
+  }
+
+  friend BitSet operator|(BitSet lhs, BitSet const& rhs)
+  {
+    return lhs |= rhs;
+  }
+
+  bool operator==(BitSet const& other) const
+  {
+    return Private::BitWordsEqual(Words_, other.Words_, WordCount);
+  }
+
+  bool operator!=(BitSet const& other) const
+  {
+    return !operator==(other);
+  }
+
+  constexpr i32 Size() const
+  {
+    return Bits;
+  }
+
+  constexpr Span<u64 const> Words() const
+  {
+    return Span<u64 const>(Words_, WordCount);
+  }
+};
+
+// Set of bits whose size is chosen at runtime, bits past the size are always clear.
+// Operations combining two sets require them to have the same size.
+class DynamicBitSet
+{
+  Vector<u64> Words_;
+  i32         Size_;
+
+  constexpr static i32 WordCountFor(i32 const bits)
+  {
+    return (bits + 63) / 64;
+  }
+
+public:
+  DynamicBitSet(IAllocator* allocator = GetGlobalAllocator())
+      : Words_(allocator)
+      , Size_(0)
+  {
+  }
+
+  explicit DynamicBitSet(i32 const bits, IAllocator* allocator = GetGlobalAllocator())
+      : Words_(WordCountFor(bits), 0ull, allocator)
+      , Size_(bits)
+  {
+    checkf(bits >= 0, "DynamicBitSet size shall be positive.");
+  }
+
+  IAllocator* Allocator() const
+  {
+    return Words_.Allocator();
+  }
+
+  // New bits are clear.
+  void Resize(i32 const bits)
+  {
+    checkf(bits >= 0, "DynamicBitSet size shall be positive.");
+    Words_.Resize(WordCountFor(bits), 0ull);
+    Size_ = bits;
+    if (bits % 64 != 0)
+      Words_.Back() &= Private::BitWordsTailMask(bits);
+  }
+
+  bool Test(i32 const bit) const
+  {
+    checkf(bit >= 0 && bit < Size_, "DynamicBitSet index out of range.");
+    return (Words_[bit >> 6] >> (bit & 63)) & 1;
+  }
+
+  void Set(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Size_, "DynamicBitSet index out of range.");
+    Words_[bit >> 6] |= 1ull << (bit & 63);
+  }
+
+  void Reset(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Size_, "DynamicBitSet index out of range.");
+    Words_[bit >> 6] &= ~(1ull << (bit & 63));
+  }
+
+  void Flip(i32 const bit)
+  {
+    checkf(bit >= 0 && bit < Size_, "DynamicBitSet index out of range.");
+    Words_[bit >> 6] ^= 1ull << (bit & 63);
+  }
+
+  void SetAll()
+  {
+    for (u64& word : Words_)
+      word = ~0ull;
+    if (!Words_.IsEmpty())
+      Words_.Back() = Private::BitWordsTailMask(Size_);
+  }
+
+  void Reset()
+  {
+    for (u64& word : Words_)
+      word = 0;
+  }
+
+  i32 Count() const
+  {
+    return Private::BitWordsCount(Words_.Data(), Words_.Size());
+  }
+
+  bool Any() const
+  {
+    return Private::BitWordsAny(Words_.Data(), Words_.Size());
+  }
+
+  bool None() const
+  {
+    return !Any();
+  }
+
+  bool ContainsAll(DynamicBitSet const& other) const
+  {
+    checkf(Size_ == other.Size_, "DynamicBitSet sizes don't match.");
+    return Private::BitWordsContainsAll(Words_.Data(), other.Words_.Data(), Words_.Size());
+  }
+
+  bool Intersects(DynamicBitSet const& other) const
+  {
+    checkf(Size_ == other.Size_, "DynamicBitSet sizes don't match.");
+    return Private::BitWordsIntersects(Words_.Data(), other.Words_.Data(), Words_.Size());
+  }
+
+  i32 FindNextSet(i32 const from) const
+  {
+    return from >= Size_ ? -1 : Private::BitWordsFindNextSet(Words_.Data(), Words_.Size(), from);
+  }
+
+  i32 FindFirstSet() const
+  {
+    return FindNextSet(0);
+  }
+
+  DynamicBitSet& operator&=(DynamicBitSet const& other)
+  {
+    checkf(Size_ == other.Size_, "DynamicBitSet sizes don't match.");
+    Private::BitWordsAnd(Words_.Data(), other.Words_.Data(), Words_.Size());
+    return *this;
+  }
+
+  DynamicBitSet& operator|=(DynamicBitSet const& other)
+  {
+    checkf(Size_ == other.Size_, "DynamicBitSet sizes don't match.");
+    Private::BitWordsOr(Words_.Data(), other.Words_.Data(), Words_.Size());
+    return *this;
+  }
+
+  DynamicBitSet& AndNot(DynamicBitSet const& other)
+  {
+    checkf(Size_ == other.Size_, "DynamicBitSet sizes don't match.");
+    Private::BitWordsAndNot(Words_.Data(), other.Words_.Data(), Words_.Size());
+    return *this;
+  }
+
+  bool operator==(DynamicBitSet const& other) const
+  {
+    return Size_ == other.Size_ && Private::BitWordsEqual(Words_.Data(), other.Words_.Data(), Words_.Size());
+  }
+
+  bool operator!=(DynamicBitSet const& other) const
+  {
+    return !operator==(other);
+  }
+
+  i32 Size() const
+  {
+    return Size_;
+  }
+
+  Span<u64 const> Words() const
+  {
+    return Span<u64 const>(Words_.Data(), Words_.Size());
+  }
+};
+} // namespace Core
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Definitions.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Core
+{
+// Unordered container whose elements never move: they live in fixed-size buckets allocated from an IAllocator,
+// so pointers stay valid until the element itself is erased.
+// Erased slots are grouped in skip blocks: the first and last slot of a block store its length, which lets
+// iteration jump over holes in O(1), and the blocks of a bucket form a free list reused by the next insertions.
+// Emplace and Erase are O(1). The last emptied bucket is kept for the next one needed, so spawning and destroying
+// around a bucket boundary doesn't hit the allocator each time. Other emptied buckets are released right away.
+template <typename T, i32 BucketSize = 64>
+class BucketArray
+{
+  static_assert(BucketSize > 1 && BucketSize < 65'535, "BucketArray bucket size shall fit the u16 skip field.");
+
+  struct Bucket;
+
+  // Links of a skip block, stored in the first slot of the block
+  struct FreeBlock
+  {
+    u16 Prev_;
+    u16 Next_;
+  };
+
+  struct Slot
+  {
+    alignas(T) alignas(FreeBlock) u8 Storage_[sizeof(T) > sizeof(FreeBlock) ? sizeof(T) : sizeof(FreeBlock)];
+    Bucket* Bucket_; // Lets Erase find the bucket from a plain pointer
+
+    T* Item()
+    {
+      return (T*)Storage_;
+    }
+
+    FreeBlock& Block()
+    {
+      return *(FreeBlock*)Storage_;
+    }
+  };
+
+  struct Bucket
+  {
+    Bucket* Prev_;
+    Bucket* Next_;
+    Bucket* PrevWithFree_;
+    Bucket* NextWithFree_;
+    i32     Used_; // Slots ever constructed, always the front ones
+    i32     LiveCount_;
+    u16     FreeHead_;             // First skip block, NoBlock if none
+    u16     Skip_[BucketSize + 1]; // 0 for live and never used slots, the last one is a sentinel
+    Slot    Slots_[BucketSize];
+  };
+
+  inline static constexpr u16 NoBlock = 0xFFFF;
+
+  IAllocator* Allocator_;
+  Bucket*     Head_;
+  Bucket*     Tail_;
+  Bucket*     WithFree_; // Buckets having at least one skip block
+  Bucket*     Spare_;    // Emptied bucket, unlinked, reused by the next AllocBucket()
+  i32         Size_;
+  i32         BucketCount_;
+
+  Bucket* AllocBucket()
+  {
+    auto* bucket = std::exchange(Spare_, nullptr);
+    if (!bucket)
+    {
+      bucket = (Bucket*)Allocator_->Alloc(sizeof(Bucket), alignof(Bucket));
+      checkf(bucket, "Couldn't allocate BucketArray bucket.");
+    }
+    bucket->Prev_         = Tail_;
+    bucket->Next_         = nullptr;
+    bucket->PrevWithFree_ = nullptr;
+    bucket->NextWithFree_ = nullptr;
+    bucket->Used_         = 0;
+    bucket->LiveCount_    = 0;
+    bucket->FreeHead_     = NoBlock;
+    for (u16& skip : bucket->Skip_)
+      skip = 0;
+
+    if (Tail_)
+      Tail_->Next_ = bucket;
+    else
+      Head_ = bucket;
+    Tail_ = bucket;
+    ++BucketCount_;
+    return bucket;
+  }
+
+  void ReleaseBucket(Bucket* bucket)
+  {
+    (bucket->Prev_ ? bucket->Prev_->Next_ : Head_) = bucket->Next_;
+    (bucket->Next_ ? bucket->Next_->Prev_ : Tail_) = bucket->Prev_;
+    if (bucket->FreeHead_ != NoBlock)
+      UnlinkWithFree(bucket);
+    --BucketCount_;
+    if (Spare_)
+      Allocator_->FreeSized(bucket, sizeof(Bucket), alignof(Bucket));
+    else
+      Spare_ = bucket;
+  }
+
+  void LinkWithFree(Bucket* bucket)
+  {
+    bucket->PrevWithFree_ = nullptr;
+    bucket->NextWithFree_ = WithFree_;
+    if (WithFree_)
+      WithFree_->PrevWithFree_ = bucket;
+    WithFree_ = bucket;
+  }
+
+  void UnlinkWithFree(Bucket* bucket)
+  {
+    (bucket->PrevWithFree_ ? bucket->PrevWithFree_->NextWithFree_ : WithFree_) = bucket->NextWithFree_;
+    if (bucket->NextWithFree_)
+      bucket->NextWithFree_->PrevWithFree_ = bucket->PrevWithFree_;
+  }
+
+  // Makes the skip block starting at `from` start at `to` instead, keeping its place in the free list.
+  static void MoveBlock(Bucket* bucket, u16 const from, u16 const to)
+  {
+    FreeBlock const block      = bucket->Slots_[from].Block();
+    bucket->Slots_[to].Block() = block;
+    (block.Prev_ != NoBlock ? bucket->Slots_[block.Prev_].Block().Next_ : bucket->FreeHead_) = to;
+    if (block.Next_ != NoBlock)
+      bucket->Slots_[block.Next_].Block().Prev_ = to;
+  }
+
+  static void UnlinkBlock(Bucket* bucket, u16 const start)
+  {
+    FreeBlock const block = bucket->Slots_[start].Block();
+    (block.Prev_ != NoBlock ? bucket->Slots_[block.Prev_].Block().Next_ : bucket->FreeHead_) = block.Next_;
+    if (block.Next_ != NoBlock)
+      bucket->Slots_[block.Next_].Block().Prev_ = block.Prev_;
+  }
+
+  // Takes the first slot of the first skip block of `bucket`.
+  static i32 TakeFreeSlot(Bucket* bucket)
+  {
+    u16 const start  = bucket->FreeHead_;
+    u16 const length = bucket->Skip_[start];
+    if (length == 1)
+      UnlinkBlock(bucket, start);
+    else
+    {
+      MoveBlock(bucket, start, u16(start + 1));
+      bucket->Skip_[start + 1]          = u16(length - 1);
+      bucket->Skip_[start + length - 1] = u16(length - 1);
+    }
+    bucket->Skip_[start] = 0;
+    return start;
+  }
+
+  // Marks `index` as erased, merging it with the neighbouring skip blocks.
+  static void AddToSkipField(Bucket* bucket, i32 const index)
+  {
+    u16* const skip  = bucket->Skip_;
+    u16 const  left  = index > 0 ? skip[index - 1] : u16(0);
+    u16 const  right = skip[index + 1];
+
+    if (left == 0 && right == 0)
+    {
+      skip[index]                   = 1;
+      bucket->Slots_[index].Block() = FreeBlock{NoBlock, bucket->FreeHead_};
+      if (bucket->FreeHead_ != NoBlock)
+        bucket->Slots_[bucket->FreeHead_].Block().Prev_ = u16(index);
+      bucket->FreeHead_ = u16(index);
+    }
+    else if (right == 0)
+    {
+      skip[index - left] = u16(left + 1);
+      skip[index]        = u16(left + 1);
+    }
+    else if (left == 0)
+    {
+      MoveBlock(bucket, u16(index + 1), u16(index));
+      skip[index]         = u16(right + 1);
+      skip[index + right] = u16(right + 1);
+    }
+    else
+    {
+      UnlinkBlock(bucket, u16(index + 1));
+      skip[index - left]  = u16(left + right + 1);
+      skip[index + right] = u16(left + right + 1);
+    }
+  }
+
+  template <typename ValueT>
+  class IteratorBase
+  {
+    friend class BucketArray;
+
+    Bucket* Bucket_;
+    i32     Index_;
+
+    IteratorBase(Bucket* bucket, i32 const index)
+        : Bucket_(bucket)
+        , Index_(index)
+    {
+    }
+
+    // Moves to the first live slot at or after the current one.
+    void Settle()
+    {
+      while (Bucket_)
+      {
+        Index_ += Bucket_->Skip_[Index_];
+        if (Index_ < Bucket_->Used_)
+          return;
+        Bucket_ = Bucket_->Next_;
+        Index_  = 0;
+      }
+    }
+
+  public:
+    IteratorBase()
+        : Bucket_(nullptr)
+        , Index_(0)
+    {
+    }
+
+    ValueT& operator*() const
+    {
+      return *Bucket_->Slots_[Index_].Item();
+    }
+
+    ValueT* operator->() const
+    {
+      return Bucket_->Slots_[Index_].Item();
+    }
+
+    IteratorBase& operator++()
+    {
+      ++Index_;
+      Settle();
+      return *this;
+    }
+
+    IteratorBase operator++(int)
+    {
+      IteratorBase copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(IteratorBase const& other) const
+    {
+      return Bucket_ == other.Bucket_ && Index_ == other.Index_;
+    }
+
+    bool operator!=(IteratorBase const& other) const
+    {
+      return !operator==(other);
+    }
+  };
+
+public:
+  using Iterator      = IteratorBase<T>;
+  using ConstIterator = IteratorBase<T const>;
+
+  explicit BucketArray(IAllocator* allocator = GetGlobalAllocator())
+      : Allocator_(allocator)
+      , Head_(nullptr)
+      , Tail_(nullptr)
+      , WithFree_(nullptr)
+      , Spare_(nullptr)
+      , Size_(0)
+      , BucketCount_(0)
+  {
+    checkf(allocator, "Invalid allocator!");
+  }
+
+  // Elements are never relocated, so the buckets can't be copied, but they can be handed over.
+  BucketArray(BucketArray const&)            = delete;
+  BucketArray& operator=(BucketArray const&) = delete;
+
+  BucketArray(BucketArray&& other)
+      : Allocator_(other.Allocator_)
+      , Head_(std::exchange(other.Head_, nullptr))
+      , Tail_(std::exchange(other.Tail_, nullptr))
+      , WithFree_(std::exchange(other.WithFree_, nullptr))
+      , Spare_(std::exchange(other.Spare_, nullptr))
+      , Size_(std::exchange(other.Size_, 0))
+      , BucketCount_(std::exchange(other.BucketCount_, 0))
+  {
+    checkf(other.Allocator_->IsMovable(), "BucketArray allocator shall be movable.");
+    if (Allocator_->OwnedByContainer())
+      other.Allocator_ = GetGlobalAllocator();
+  }
+
+  ~BucketArray()
+  {
+    Clear();
+    if (Allocator_->OwnedByContainer())
+      delete Allocator_;
+  }
+
+  IAllocator* Allocator() const
+  {
+    return Allocator_;
+  }
+
+  // The returned pointer stays valid until the element is erased.
+  template <typename... Args>
+  T* Emplace(Args&&... args)
+  {
+    Bucket* bucket;
+    i32     index;
+    if (WithFree_)
+    {
+      bucket = WithFree_;
+      index  = TakeFreeSlot(bucket);
+      if (bucket->FreeHead_ == NoBlock)
+        UnlinkWithFree(bucket);
+    }
+    else
+    {
+      bucket = Tail_ && Tail_->Used_ < BucketSize ? Tail_ : AllocBucket();
+      index  = bucket->Used_++;
+    }
+
+    Slot& slot   = bucket->Slots_[index];
+    slot.Bucket_ = bucket;
+    T* item      = new (slot.Item()) T(std::forward<Args>(args)...);
+    ++bucket->LiveCount_;
+    ++Size_;
+    return item;
+  }
+
+  // `item` shall be an element of this array.
+  void Erase(T* item)
+  {
+    checkf(item, "Can't erase a null BucketArray element.");
+    Slot*     slot   = (Slot*)item;
+    Bucket*   bucket = slot->Bucket_;
+    i32 const index  = i32(slot - bucket->Slots_);
+    checkf(index >= 0 && index < bucket->Used_ && bucket->Skip_[index] == 0, "Element isn't part of this BucketArray.");
+
+    item->~T();
+    --Size_;
+    if (--bucket->LiveCount_ == 0)
+    {
+      ReleaseBucket(bucket);
+      return;
+    }
+
+    bool const hadFree = bucket->FreeHead_ != NoBlock;
+    AddToSkipField(bucket, index);
+    if (!hadFree)
+      LinkWithFree(bucket);
+  }
+
+  // Returns the iterator following the erased element.
+  Iterator Erase(Iterator it)
+  {
+    Iterator next = it;
+    ++next;
+    Erase(&*it);
+    return next;
+  }
+
+  // Also releases the spare bucket.
+  void Clear()
+  {
+    for (Bucket* bucket = Head_; bucket;)
+    {
+      Bucket* next = bucket->Next_;
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        for (i32 index = bucket->Skip_[0]; index < bucket->Used_;)
+        {
+          bucket->Slots_[index].Item()->~T();
+          ++index;
+          index += bucket->Skip_[index];
+        }
+      }
+      Allocator_->FreeSized(bucket, sizeof(Bucket), alignof(Bucket));
+      bucket = next;
+    }
+    if (Spare_)
+      Allocator_->FreeSized(Spare_, sizeof(Bucket), alignof(Bucket));
+    Spare_       = nullptr;
+    Head_        = nullptr;
+    Tail_        = nullptr;
+    WithFree_    = nullptr;
+    Size_        = 0;
+    BucketCount_ = 0;
+  }
+
+  i32 Size() const
+  {
+    return Size_;
+  }
+
+  bool IsEmpty() const
+  {
+    return Size_ == 0;
+  }
+
+  i32 BucketCount() const
+  {
+    return BucketCount_;
+  }
+
+  Iterator begin()
+  {
+    Iterator it(Head_, 0);
+    it.Settle();
+    return it;
+  }
+  ConstIterator begin() const
+  {
+    ConstIterator it(Head_, 0);
+    it.Settle();
+    return it;
+  }
+
+  Iterator end()
+  {
+    return Iterator();
+  }
+  ConstIterator end() const
+  {
+    return ConstIterator();
+  }
+};
+} // namespace Core
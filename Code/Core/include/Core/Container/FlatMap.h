@@ -1,16 +1,22 @@
 #pragma once
 
+#include <Core/Concepts/Concepts.h>
 #include <Core/Container/Vector.h>
 #include <Core/Definitions.h>
+#include <Core/Platform/Cpu.h>
 #include <algorithm>
+#include <bit>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#  define GE_FLATMAP_PREFETCH 1
+#  include <immintrin.h>
+#endif
 
 namespace Core
 {
-template <typename T>
-concept Sortable = requires(T a, T b) {
-  a < b ? 0 : 1;
-};
-
 namespace Private
 {
 template <typename Key, typename Value>
@@ -23,6 +29,93 @@ struct KeyValueRef
 constexpr int KeyValueIterator = 0;
 constexpr int KeyIterator      = 1;
 constexpr int ValueIterator    = 2;
+
+// Maps up to this size are searched linearly: a few compares on one or two cache lines beat the
+// mispredicted branches of a binary search.
+inline constexpr i32 FlatMapLinearScanMaxSize = 16;
+
+#if GE_CPU_X64
+// The whole vectors of LinearLowerBound, for 4 and 8 bytes integer keys. Returns how many keys were compared and
+// adds the lower ones to `lower`.
+template <typename Key>
+GE_TARGET("avx2") i32 LinearLowerBoundAvx2(Key const* keys, i32 const count, Key const key, i32& lower)
+{
+  i32 i = 0;
+  if constexpr (sizeof(Key) == 8)
+  {
+    // AVX2 only compares signed lanes, flipping the sign bit maps the unsigned order on the signed one
+    __m256i const bias   = _mm256_set1_epi64x(std::is_signed_v<Key> ? 0 : i64(1ull << 63));
+    __m256i const needle = _mm256_xor_si256(_mm256_set1_epi64x(i64(key)), bias);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m256i const lanes = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(keys + i)), bias);
+      lower += std::popcount(u32(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, lanes)))));
+    }
+  }
+  else
+  {
+    __m256i const bias   = _mm256_set1_epi32(std::is_signed_v<Key> ? 0 : i32(1u << 31));
+    __m256i const needle = _mm256_xor_si256(_mm256_set1_epi32(i32(key)), bias);
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256i const lanes = _mm256_xor_si256(_mm256_loadu_si256((__m256i const*)(keys + i)), bias);
+      lower += std::popcount(u32(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, lanes)))));
+    }
+  }
+  _mm256_zeroupper();
+  return i;
+}
+#endif
+
+// Number of keys lower than `key` in the sorted `keys`, ie. the position of its lower bound.
+// Branchless, integer keys are compared 4 or 8 at a time when the CPU has AVX2.
+template <typename Key, typename U>
+i32 LinearLowerBound(Key const* keys, i32 const count, U const& key)
+{
+  i32 lower = 0;
+  i32 i     = 0;
+#if GE_CPU_X64
+  if constexpr (std::is_same_v<Key, U> && std::is_integral_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8))
+  {
+    // Below 8 keys, setting up the vectors costs more than the scalar compares
+    if (count >= 8 && HasAvx2())
+      i = LinearLowerBoundAvx2(keys, count, key, lower);
+  }
+#endif
+  for (; i < count; ++i)
+    lower += keys[i] < key ? 1 : 0;
+  return lower;
+}
+
+inline void FlatMapPrefetch(void const* p)
+{
+#if GE_FLATMAP_PREFETCH
+  _mm_prefetch((char const*)p, _MM_HINT_T0);
+#else
+  (void)p;
+#endif
+}
+
+// Indices of the items of [begin, end) sorted by key, only the first item of each key is kept.
+// Items are anything exposing Key_ and Value_, e.g. a FlatMap or CompactFlatMap item.
+template <std::random_access_iterator Iterator>
+Vector<i32> SortedUniqueOrder(Iterator begin, Iterator end)
+{
+  i32 const   count = i32(end - begin);
+  Vector<i32> order;
+  order.Reserve(count);
+  for (i32 i = 0; i < count; ++i)
+    order.EmplaceBack(i);
+
+  std::stable_sort(order.begin(), order.end(), [begin](i32 const a, i32 const b) { return begin[a].Key_ < begin[b].Key_; });
+
+  i32 kept = 0;
+  for (i32 i = 0; i < count; ++i)
+    if (kept == 0 || begin[order[kept - 1]].Key_ < begin[order[i]].Key_)
+      order[kept++] = order[i];
+  order.Resize(kept);
+  return order;
+}
 } // namespace Private
 
 template <typename Key, typename Value>
@@ -144,10 +237,65 @@ class FlatMap
   Vector<Key>   Keys_;
   Vector<Value> Values_;
 
+  // Optional search index built by BuildSearchIndex: the keys in Eytzinger order, where the children of
+  // node k are 2k and 2k + 1 (node 0 is unused), and the sorted position of each node.
+  Vector<Key> EytzingerKeys_;
+  Vector<i32> EytzingerToSorted_;
+
+  void DropSearchIndex()
+  {
+    EytzingerKeys_.Clear();
+    EytzingerToSorted_.Clear();
+  }
+
+  // In-order walk of the implicit tree, so the nodes get the keys in sorted order.
+  void FillSearchIndex(i32 const node, i32& sorted)
+  {
+    if (node >= EytzingerKeys_.Size())
+      return;
+    FillSearchIndex(2 * node, sorted);
+    EytzingerKeys_[node]     = Keys_[sorted];
+    EytzingerToSorted_[node] = sorted++;
+    FillSearchIndex(2 * node + 1, sorted);
+  }
+
+  // Branchless descent, prefetching the nodes 4 levels below, which share a cache line or two.
+  template <typename U>
+  i32 EytzingerLowerBound(U const& u) const
+  {
+    Key const* keys  = EytzingerKeys_.Data();
+    u32 const  count = u32(EytzingerKeys_.Size() - 1);
+    u32        node  = 1;
+    while (node <= count)
+    {
+      Private::FlatMapPrefetch((u8 const*)keys + u64(node) * 16 * sizeof(Key));
+      node = 2 * node + (keys[node] < u ? 1 : 0);
+    }
+    // The lower bound is where the descent last went left: drop the trailing right turns, then that left turn
+    node >>= std::countr_one(node) + 1;
+    return node == 0 ? Keys_.Size() : EytzingerToSorted_[i32(node)];
+  }
+
+  // Position of the first key not lower than `u`, searched with the strategy fitting this map.
+  template <typename U>
+  constexpr i32 LowerBound(U const& u) const
+  {
+    if (!std::is_constant_evaluated())
+    {
+      if (Keys_.Size() <= Private::FlatMapLinearScanMaxSize)
+        return Private::LinearLowerBound(Keys_.Data(), Keys_.Size(), u);
+      if (!EytzingerKeys_.IsEmpty())
+        return EytzingerLowerBound(u);
+    }
+    return i32(std::lower_bound(Keys_.begin(), Keys_.end(), u) - Keys_.begin());
+  }
+
 public:
   constexpr FlatMap(IAllocator* allocator = GetGlobalAllocator())
       : Keys_(allocator)
       , Values_(allocator)
+      , EytzingerKeys_(allocator)
+      , EytzingerToSorted_(allocator)
   {
   }
 
@@ -190,17 +338,13 @@ public:
     return Find(u);
   }
 
+  // Small maps are scanned linearly, large ones use the search index if built, otherwise a binary search.
   template <typename U = Key>
   constexpr Value const* Find(U const& u) const
   {
-    auto begin = Keys_.begin();
-    auto end   = Keys_.end();
-    auto it    = std::lower_bound(begin, end, u);
-    if (it != end && *it == u)
-    {
-      Value const* v = Values_.Data() + (it - begin);
-      return v;
-    }
+    i32 const pos = LowerBound(u);
+    if (pos < Keys_.Size() && Keys_[pos] == u)
+      return Values_.Data() + pos;
     return nullptr;
   }
 
@@ -217,6 +361,106 @@ public:
     Values_.Reserve(Capacity);
   }
 
+  constexpr i32 Size() const
+  {
+    return Keys_.Size();
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Keys_.IsEmpty();
+  }
+
+  // Lays the keys out for a cache friendly search of large, read-mostly maps (e.g. registries frozen after loading).
+  // Costs a copy of the keys plus an i32 per item, and is dropped by the next modification of the map.
+  void BuildSearchIndex()
+  {
+    DropSearchIndex();
+    if (Keys_.Size() <= Private::FlatMapLinearScanMaxSize)
+      return;
+
+    EytzingerKeys_.Assign(Keys_.Size() + 1, Keys_[0]);
+    EytzingerToSorted_.Assign(Keys_.Size() + 1, 0);
+    i32 sorted = 0;
+    FillSearchIndex(1, sorted);
+  }
+
+  bool HasSearchIndex() const
+  {
+    return !EytzingerKeys_.IsEmpty();
+  }
+
+  // Replaces the content with the items of an unsorted range in O(N log N), instead of O(N^2) for N TryEmplace.
+  // When a key appears several times, its first item wins.
+  template <std::random_access_iterator Iterator>
+  void BuildFrom(Iterator begin, Iterator end)
+  {
+    Vector<i32> const order = Private::SortedUniqueOrder(begin, end);
+    Clear();
+    Reserve(order.Size());
+    for (i32 const index : order)
+    {
+      Keys_.EmplaceBack(begin[index].Key_);
+      Values_.EmplaceBack(begin[index].Value_);
+    }
+  }
+
+  // Inserts the items of an unsorted range whose key isn't in the map yet, returns how many were inserted.
+  // The new items are sorted then merged, so the existing ones move at most once.
+  template <std::random_access_iterator Iterator>
+  i32 Insert(Iterator begin, Iterator end)
+  {
+    Vector<i32> const order    = Private::SortedUniqueOrder(begin, end);
+    i32 const         oldCount = Keys_.Size();
+    DropSearchIndex();
+
+    // Append the new items, then merge from the back
+    i32 cursor = 0;
+    for (i32 const index : order)
+    {
+      Key const& key = begin[index].Key_;
+      while (cursor < oldCount && Keys_[cursor] < key)
+        ++cursor;
+      if (cursor < oldCount && !(key < Keys_[cursor]))
+        continue;
+      Keys_.EmplaceBack(key);
+      Values_.EmplaceBack(begin[index].Value_);
+    }
+
+    i32 const added = Keys_.Size() - oldCount;
+    if (added == 0 || oldCount == 0)
+      return added;
+
+    Vector<Key>   newKeys;
+    Vector<Value> newValues;
+    newKeys.Reserve(added);
+    newValues.Reserve(added);
+    for (i32 i = oldCount; i < Keys_.Size(); ++i)
+    {
+      newKeys.EmplaceBack(std::move(Keys_[i]));
+      newValues.EmplaceBack(std::move(Values_[i]));
+    }
+
+    i32 write = Keys_.Size() - 1;
+    i32 old   = oldCount - 1;
+    for (i32 next = added - 1; next >= 0; --write)
+    {
+      if (old >= 0 && newKeys[next] < Keys_[old])
+      {
+        Keys_[write]   = std::move(Keys_[old]);
+        Values_[write] = std::move(Values_[old]);
+        --old;
+      }
+      else
+      {
+        Keys_[write]   = std::move(newKeys[next]);
+        Values_[write] = std::move(newValues[next]);
+        --next;
+      }
+    }
+    return added;
+  }
+
   template <typename U = Key, typename... Args>
   constexpr Value* TryEmplace(U&& key, Args&&... args)
   {
@@ -227,6 +471,7 @@ public:
       return nullptr;
 
     i32 const pos = i32(it - begin);
+    DropSearchIndex();
     Keys_.Emplace(pos, std::forward<U>(key));
     auto * value = Values_.Emplace(pos, std::forward<Args>(args)...);
     return value;
@@ -238,10 +483,11 @@ public:
     auto begin = Keys_.begin();
     auto end   = Keys_.end();
     auto it    = std::lower_bound(begin, end, key);
-    if (it != end || *it != key)
+    if (it == end || *it != key)
       return false;
 
     i32 const pos = i32(it - begin);
+    DropSearchIndex();
     Keys_.Erase(pos);
     Values_.Erase(pos);
     return true;
@@ -251,6 +497,7 @@ public:
   {
     Keys_.Clear();
     Values_.Clear();
+    DropSearchIndex();
   }
 };
 
@@ -260,7 +507,9 @@ class CompactFlatMapIterator;
 template <typename KV, typename Key, typename Value, int Kind>
 class CompactFlatMapFakeContainer;
 
-template <Sortable Key, typename Value>
+// Sorted map storing key/value pairs contiguously.
+// `Storage` is the backing dynamic array, e.g. InlineStorage<N>::Type to keep small maps inside the object.
+template <Sortable Key, typename Value, template <typename> typename Storage = Vector>
 class CompactFlatMap
 {
 public:
@@ -292,7 +541,7 @@ public:
   };
 
 private:
-  Vector<KeyValue> Items_;
+  Storage<KeyValue> Items_;
 
 public:
   constexpr CompactFlatMap(IAllocator* allocator = GetGlobalAllocator())
@@ -305,9 +554,9 @@ public:
     return {Items_.begin()};
   }
 
-  CompactFlatMapIterator<KeyValue, Key const, Value const, Private::KeyValueIterator> begin() const
+  CompactFlatMapIterator<KeyValue const, Key const, Value const, Private::KeyValueIterator> begin() const
   {
-    return Items_.begin();
+    return {Items_.begin()};
   }
 
   CompactFlatMapIterator<KeyValue, Key const, Value, Private::KeyValueIterator> end()
@@ -315,7 +564,7 @@ public:
     return {Items_.end()};
   }
 
-  CompactFlatMapIterator<KeyValue, Key const, Value const, Private::KeyValueIterator> end() const
+  CompactFlatMapIterator<KeyValue const, Key const, Value const, Private::KeyValueIterator> end() const
   {
     return {Items_.end()};
   }
@@ -341,12 +590,23 @@ public:
     return Find(u);
   }
 
+  // Small maps are scanned linearly, larger ones use a binary search.
   template <typename U = Key>
   constexpr Value const* Find(U const& u) const
   {
     auto begin = Items_.begin();
     auto end   = Items_.end();
-    auto it    = std::lower_bound(begin, end, u);
+    auto it    = begin;
+    if (!std::is_constant_evaluated() && Items_.Size() <= Private::FlatMapLinearScanMaxSize)
+    {
+      i32 lower = 0;
+      for (auto const& item : Items_)
+        lower += item.Key_ < u ? 1 : 0;
+      it += lower;
+    }
+    else
+      it = std::lower_bound(begin, end, u);
+
     if (it != end && *it == u)
       return &it->Value_;
     return nullptr;
@@ -364,6 +624,51 @@ public:
     Items_.Reserve(Capacity);
   }
 
+  constexpr i32 Size() const
+  {
+    return Items_.Size();
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Items_.IsEmpty();
+  }
+
+  // Replaces the content with the items of an unsorted range in O(N log N), instead of O(N^2) for N TryEmplace.
+  // When a key appears several times, its first item wins.
+  template <std::random_access_iterator Iterator>
+  void BuildFrom(Iterator begin, Iterator end)
+  {
+    Vector<i32> const order = Private::SortedUniqueOrder(begin, end);
+    Clear();
+    Reserve(order.Size());
+    for (i32 const index : order)
+      Items_.EmplaceBack(begin[index].Key_, begin[index].Value_);
+  }
+
+  // Inserts the items of an unsorted range whose key isn't in the map yet, returns how many were inserted.
+  // The new items are sorted then merged, so the existing ones move at most once.
+  template <std::random_access_iterator Iterator>
+  i32 Insert(Iterator begin, Iterator end)
+  {
+    Vector<i32> const order    = Private::SortedUniqueOrder(begin, end);
+    i32 const         oldCount = Items_.Size();
+
+    i32 cursor = 0;
+    for (i32 const index : order)
+    {
+      Key const& key = begin[index].Key_;
+      while (cursor < oldCount && Items_[cursor].Key_ < key)
+        ++cursor;
+      if (cursor < oldCount && !(key < Items_[cursor].Key_))
+        continue;
+      Items_.EmplaceBack(key, begin[index].Value_);
+    }
+
+    std::inplace_merge(Items_.begin(), Items_.begin() + oldCount, Items_.end(), [](KeyValue const& a, KeyValue const& b) { return a.Key_ < b.Key_; });
+    return Items_.Size() - oldCount;
+  }
+
   template <typename U = Key, typename... Args>
   constexpr bool TryEmplace(U&& key, Args&&... args)
   {
@@ -383,7 +688,7 @@ public:
     auto begin = Items_.begin();
     auto end   = Items_.end();
     auto it    = std::lower_bound(begin, end, key);
-    if (it != end || *it != key)
+    if (it == end || *it != key)
       return false;
 
     Items_.Erase(it);
@@ -516,7 +821,10 @@ public:
 
   constexpr decltype(auto) end() const
   {
-    return CompactFlatMapIterator<KV, Key, Value, Kind>{Curr_};
+    return CompactFlatMapIterator<KV, Key, Value, Kind>{End_};
   }
 };
+
+template <Sortable Key, typename Value>
+inline constexpr bool IsTriviallyRelocatable<FlatMap<Key, Value>> = true;
 } // namespace Core
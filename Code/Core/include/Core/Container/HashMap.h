@@ -0,0 +1,596 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Container/FlatMap.h>
+#include <Core/Definitions.h>
+#include <Core/Hash/Hash.h>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define GE_HASHMAP_SSE2 1
+#  include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#  define GE_HASHMAP_NEON 1
+#  include <arm_neon.h>
+#endif
+
+namespace Core
+{
+namespace Private
+{
+// Metadata of 15 slots: one control byte per slot, plus a trailing overflow byte.
+// A control byte is 0 when the slot is empty, otherwise the 7 top bits of the hash with the high bit set.
+// Overflow bit `hash % 8` is set when an item of that hash had to probe past the group because it was full,
+// lookups stop at the first group where their overflow bit is clear, so erasing never needs a tombstone.
+struct HashMapGroup
+{
+  inline static constexpr i32 Slots    = 15;
+  inline static constexpr i32 Overflow = 15;
+  inline static constexpr u8  Empty    = 0;
+  inline static constexpr u32 SlotMask = (1u << Slots) - 1;
+
+  // Bitmask of the slots whose control byte is `value`.
+  static u32 Match(u8 const* group, u8 const value)
+  {
+#if GE_HASHMAP_SSE2
+    __m128i const ctrl = _mm_load_si128((__m128i const*)group);
+    return u32(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)))) & SlotMask;
+#elif GE_HASHMAP_NEON
+    // No movemask on NEON: weight each lane by its bit, then add the lanes of each half
+    static constexpr u8 bits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t const    eq       = vceqq_u8(vld1q_u8(group), vdupq_n_u8(value));
+    uint8x16_t const    masked   = vandq_u8(eq, vld1q_u8(bits));
+    u32 const           low      = vaddv_u8(vget_low_u8(masked));
+    u32 const           high     = vaddv_u8(vget_high_u8(masked));
+    return (low | high << 8) & SlotMask;
+#else
+    u32 mask = 0;
+    for (i32 i = 0; i < Slots; ++i)
+      mask |= u32(group[i] == value) << i;
+    return mask;
+#endif
+  }
+
+  static u8 Tag(u64 const hash)
+  {
+    return u8(hash >> 57) | 0x80;
+  }
+
+  static u8 OverflowBit(u64 const hash)
+  {
+    return u8(1u << (hash & 7));
+  }
+};
+} // namespace Private
+
+template <typename KV, typename Key, typename Value, int Kind>
+class HashMapIterator;
+
+template <typename KV, typename Key, typename Value, int Kind>
+class HashMapFakeContainer;
+
+// Unordered associative container, open-addressing with SIMD probing of 15-slot groups (Swiss table like).
+// Items live in a single allocation made through the IAllocator, moving or erasing items never allocates.
+// Insertions may rehash, which invalidates every pointer and iterator; erasing invalidates only the erased item.
+template <typename Key, typename Value, typename Hash = Hasher<Key>>
+class HashMap
+{
+public:
+  struct KeyValue
+  {
+    Key   Key_;
+    Value Value_;
+
+    template <typename UKey = Key, typename... UArgs>
+    KeyValue(UKey&& K, UArgs&&... Vs)
+        : Key_(std::forward<UKey>(K))
+        , Value_(std::forward<UArgs>(Vs)...)
+    {
+    }
+  };
+
+private:
+  using Group = Private::HashMapGroup;
+
+  // Table is resized when Size_ would exceed 7/8 of the capacity.
+  inline static constexpr i32 MaxLoadNumerator   = 7;
+  inline static constexpr i32 MaxLoadDenominator = 8;
+
+  IAllocator* Allocator_;
+  u8*         Ctrl_;
+  KeyValue*   Slots_;
+  i32         GroupCount_;
+  i32         Size_;
+  i32         MaxLoad_;
+
+  constexpr i32 SlotCount() const
+  {
+    return GroupCount_ * Group::Slots;
+  }
+
+  // Bytes of the control block, slots start right after it.
+  static constexpr i64 CtrlSize(i32 const groupCount)
+  {
+    i64 const size = groupCount * i64(16);
+    return (size + alignof(KeyValue) - 1) / alignof(KeyValue) * alignof(KeyValue);
+  }
+
+  static constexpr i64 AllocSize(i32 const groupCount)
+  {
+    return CtrlSize(groupCount) + groupCount * i64(Group::Slots) * (i64)sizeof(KeyValue);
+  }
+
+  static constexpr i32 Alignment()
+  {
+    return alignof(KeyValue) > 16 ? (i32)alignof(KeyValue) : 16;
+  }
+
+  constexpr i32 FirstGroup(u64 const hash) const
+  {
+    return i32(hash >> 3) & (GroupCount_ - 1);
+  }
+
+  // Triangular probing, visits every group once when the group count is a power of 2.
+  constexpr i32 NextGroup(i32 const group, i32 const step) const
+  {
+    return (group + step) & (GroupCount_ - 1);
+  }
+
+  constexpr KeyValue const* FindSlot(Key const& key, u64 const hash) const;
+
+  // Places a new item in the first empty slot of its probe sequence, capacity must be available.
+  template <typename UKey, typename... Args>
+  constexpr KeyValue* EmplaceUnique(u64 const hash, UKey&& key, Args&&... args);
+
+  // Reallocates the table to `groupCount` groups and reinserts every item.
+  constexpr void Rehash(i32 const groupCount);
+
+  constexpr void Reset();
+
+  constexpr void CopyFrom(HashMap const& other);
+
+public:
+  constexpr HashMap(IAllocator* allocator = GetGlobalAllocator());
+
+  constexpr HashMap(HashMap const& other);
+  constexpr HashMap(HashMap&& other);
+
+  constexpr ~HashMap();
+
+  constexpr HashMap& operator=(HashMap const& other);
+  constexpr HashMap& operator=(HashMap&& other);
+
+  constexpr IAllocator* Allocator() const
+  {
+    return Allocator_;
+  }
+
+  HashMapIterator<KeyValue, Key const, Value, Private::KeyValueIterator> begin()
+  {
+    return {Ctrl_, Slots_, 0, SlotCount()};
+  }
+
+  HashMapIterator<KeyValue const, Key const, Value const, Private::KeyValueIterator> begin() const
+  {
+    return {Ctrl_, Slots_, 0, SlotCount()};
+  }
+
+  HashMapIterator<KeyValue, Key const, Value, Private::KeyValueIterator> end()
+  {
+    return {Ctrl_, Slots_, SlotCount(), SlotCount()};
+  }
+
+  HashMapIterator<KeyValue const, Key const, Value const, Private::KeyValueIterator> end() const
+  {
+    return {Ctrl_, Slots_, SlotCount(), SlotCount()};
+  }
+
+  constexpr HashMapFakeContainer<KeyValue const, Key const, Value const, Private::KeyIterator> Keys() const
+  {
+    return {Ctrl_, Slots_, SlotCount()};
+  }
+
+  constexpr HashMapFakeContainer<KeyValue, Key const, Value, Private::ValueIterator> Values()
+  {
+    return {Ctrl_, Slots_, SlotCount()};
+  }
+
+  constexpr HashMapFakeContainer<KeyValue const, Key const, Value const, Private::ValueIterator> Values() const
+  {
+    return {Ctrl_, Slots_, SlotCount()};
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Size_ == 0;
+  }
+
+  constexpr i32 Size() const
+  {
+    return Size_;
+  }
+
+  // Number of slots, the map holds at most 7/8 of it before growing.
+  constexpr i32 Capacity() const
+  {
+    return SlotCount();
+  }
+
+  constexpr bool Contains(Key const& key) const
+  {
+    return Find(key);
+  }
+
+  constexpr Value const* Find(Key const& key) const
+  {
+    KeyValue const* slot = FindSlot(key, Hash{}(key));
+    return slot ? &slot->Value_ : nullptr;
+  }
+
+  constexpr Value* Find(Key const& key)
+  {
+    HashMap const& selfConst = *this;
+    return const_cast<Value*>(selfConst.Find(key));
+  }
+
+  // Makes room for `capacity` items without rehashing.
+  constexpr void Reserve(i32 const capacity);
+
+  // Returns the new value, or nullptr if the key is already present.
+  template <typename U = Key, typename... Args>
+  constexpr Value* TryEmplace(U&& key, Args&&... args);
+
+  constexpr bool TryRemove(Key const& key);
+
+  constexpr void Clear();
+};
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline auto HashMap<Key, Value, Hash>::FindSlot(Key const& key, u64 const hash) const -> KeyValue const*
+{
+  if (Size_ == 0)
+    return nullptr;
+
+  u8 const tag      = Group::Tag(hash);
+  u8 const overflow = Group::OverflowBit(hash);
+  i32      group    = FirstGroup(hash);
+  for (i32 step = 1; step <= GroupCount_; ++step)
+  {
+    u8 const* ctrl = Ctrl_ + group * 16;
+    for (u32 match = Group::Match(ctrl, tag); match; match &= match - 1)
+    {
+      KeyValue const* slot = Slots_ + group * Group::Slots + std::countr_zero(match);
+      if (slot->Key_ == key)
+        return slot;
+    }
+    if (!(ctrl[Group::Overflow] & overflow))
+      return nullptr;
+    group = NextGroup(group, step);
+  }
+  return nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename UKey, typename... Args>
+constexpr inline auto HashMap<Key, Value, Hash>::EmplaceUnique(u64 const hash, UKey&& key, Args&&... args) -> KeyValue*
+{
+  i32 group = FirstGroup(hash);
+  for (i32 step = 1;; ++step)
+  {
+    u8* const ctrl  = Ctrl_ + group * 16;
+    u32 const empty = Group::Match(ctrl, Group::Empty);
+    if (empty)
+    {
+      i32 const index = std::countr_zero(empty);
+      ctrl[index]     = Group::Tag(hash);
+      ++Size_;
+      return new (Slots_ + group * Group::Slots + index) KeyValue(std::forward<UKey>(key), std::forward<Args>(args)...);
+    }
+    ctrl[Group::Overflow] |= Group::OverflowBit(hash);
+    group                  = NextGroup(group, step);
+  }
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline void HashMap<Key, Value, Hash>::Rehash(i32 const groupCount)
+{
+  checkf(std::has_single_bit((u32)groupCount), "HashMap group count must be a power of 2.");
+
+  u8* const newMem = (u8*)Allocator_->Alloc(AllocSize(groupCount), Alignment());
+  checkf(newMem, "Couldn't allocate HashMap memory.");
+  std::memset(newMem, 0, (u64)groupCount * 16);
+
+  u8* const       oldCtrl       = Ctrl_;
+  KeyValue* const oldSlots      = Slots_;
+  i32 const       oldGroupCount = GroupCount_;
+
+  Ctrl_       = newMem;
+  Slots_      = (KeyValue*)(newMem + CtrlSize(groupCount));
+  GroupCount_ = groupCount;
+  Size_       = 0;
+  MaxLoad_    = i32((i64)SlotCount() * MaxLoadNumerator / MaxLoadDenominator);
+
+  for (i32 group = 0; group < oldGroupCount; ++group)
+  {
+    u8 const* ctrl = oldCtrl + group * 16;
+    for (i32 i = 0; i < Group::Slots; ++i)
+    {
+      if (ctrl[i] == Group::Empty)
+        continue;
+
+      KeyValue& item = oldSlots[group * Group::Slots + i];
+      EmplaceUnique(Hash{}(item.Key_), std::move(item.Key_), std::move(item.Value_));
+      item.~KeyValue();
+    }
+  }
+
+  if (oldCtrl)
+    Allocator_->FreeSized(oldCtrl, AllocSize(oldGroupCount), Alignment());
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline void HashMap<Key, Value, Hash>::Reset()
+{
+  Clear();
+  if (Ctrl_)
+    Allocator_->FreeSized(Ctrl_, AllocSize(GroupCount_), Alignment());
+  Ctrl_       = nullptr;
+  Slots_      = nullptr;
+  GroupCount_ = MaxLoad_ = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline void HashMap<Key, Value, Hash>::CopyFrom(HashMap const& other)
+{
+  if (other.IsEmpty())
+    return;
+
+  // Same layout as the source, so items keep their slot and no probing is needed
+  Rehash(other.GroupCount_);
+  std::memcpy(Ctrl_, other.Ctrl_, (u64)GroupCount_ * 16);
+  for (i32 slot = 0; slot < SlotCount(); ++slot)
+  {
+    if (Ctrl_[slot / Group::Slots * 16 + slot % Group::Slots] != Group::Empty)
+      new (Slots_ + slot) KeyValue(other.Slots_[slot].Key_, other.Slots_[slot].Value_);
+  }
+  Size_    = other.Size_;
+  MaxLoad_ = other.MaxLoad_;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>::HashMap(IAllocator* allocator)
+    : Allocator_(allocator)
+    , Ctrl_(nullptr)
+    , Slots_(nullptr)
+    , GroupCount_(0)
+    , Size_(0)
+    , MaxLoad_(0)
+{
+  checkf(allocator, "Invalid allocator!");
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>::HashMap(HashMap const& other)
+    : HashMap(other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator())
+{
+  CopyFrom(other);
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>::HashMap(HashMap&& other)
+    : HashMap()
+{
+  *this = std::move(other);
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>::~HashMap()
+{
+  Reset();
+  if (Allocator_->OwnedByContainer())
+    delete Allocator_;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>& HashMap<Key, Value, Hash>::operator=(HashMap const& other)
+{
+  if (this == &other)
+    return *this;
+
+  Reset();
+  Allocator_ = other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator();
+  CopyFrom(other);
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline HashMap<Key, Value, Hash>& HashMap<Key, Value, Hash>::operator=(HashMap&& other)
+{
+  if (this == &other)
+    return *this;
+
+  Reset();
+  if (other.Allocator_->IsMovable())
+  {
+    Ctrl_       = std::exchange(other.Ctrl_, nullptr);
+    Slots_      = std::exchange(other.Slots_, nullptr);
+    GroupCount_ = std::exchange(other.GroupCount_, 0);
+    Size_       = std::exchange(other.Size_, 0);
+    MaxLoad_    = std::exchange(other.MaxLoad_, 0);
+    Allocator_  = std::exchange(other.Allocator_, GetGlobalAllocator());
+  }
+  else
+  {
+    Allocator_ = other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator();
+    if (!other.IsEmpty())
+    {
+      Rehash(other.GroupCount_);
+      for (auto&& [key, value] : other)
+        EmplaceUnique(Hash{}(key), std::move(const_cast<Key&>(key)), std::move(value));
+    }
+    other.Reset();
+  }
+  return *this;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline void HashMap<Key, Value, Hash>::Reserve(i32 const capacity)
+{
+  if (capacity <= MaxLoad_)
+    return;
+
+  i32 const minSlots  = i32((i64)capacity * MaxLoadDenominator / MaxLoadNumerator + 1);
+  i32 const minGroups = (minSlots + Group::Slots - 1) / Group::Slots;
+  Rehash((i32)std::bit_ceil((u32)minGroups));
+}
+
+template <typename Key, typename Value, typename Hash>
+template <typename U, typename... Args>
+constexpr inline Value* HashMap<Key, Value, Hash>::TryEmplace(U&& key, Args&&... args)
+{
+  u64 const hash = Hash{}(key);
+  if (FindSlot(key, hash))
+    return nullptr;
+
+  if (Size_ >= MaxLoad_)
+  {
+    // Erasing from overflowed groups lowers MaxLoad_, rehashing in place is then enough to clean the overflow bits
+    bool const mostlyErased = Size_ < SlotCount() / 2;
+    Rehash(GroupCount_ == 0 ? 1 : mostlyErased ? GroupCount_ : GroupCount_ * 2);
+  }
+  return &EmplaceUnique(hash, std::forward<U>(key), std::forward<Args>(args)...)->Value_;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline bool HashMap<Key, Value, Hash>::TryRemove(Key const& key)
+{
+  KeyValue* slot = const_cast<KeyValue*>(FindSlot(key, Hash{}(key)));
+  if (!slot)
+    return false;
+
+  i32 const index = i32(slot - Slots_);
+  u8* const ctrl  = Ctrl_ + index / Group::Slots * 16;
+  ctrl[index % Group::Slots] = Group::Empty;
+  slot->~KeyValue();
+  --Size_;
+
+  // Lookups may still probe past this group, so the freed slot doesn't count as free capacity
+  if (ctrl[Group::Overflow])
+    --MaxLoad_;
+  return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+constexpr inline void HashMap<Key, Value, Hash>::Clear()
+{
+  if constexpr (!std::is_trivially_destructible_v<KeyValue>)
+  {
+    for (i32 slot = 0; slot < SlotCount() && Size_ > 0; ++slot)
+    {
+      if (Ctrl_[slot / Group::Slots * 16 + slot % Group::Slots] != Group::Empty)
+      {
+        Slots_[slot].~KeyValue();
+        --Size_;
+      }
+    }
+  }
+  if (Ctrl_)
+    std::memset(Ctrl_, 0, (u64)GroupCount_ * 16);
+  Size_    = 0;
+  MaxLoad_ = i32((i64)SlotCount() * MaxLoadNumerator / MaxLoadDenominator);
+}
+
+template <typename KV, typename Key, typename Value, int Kind>
+class HashMapIterator
+{
+  u8 const* Ctrl_;
+  KV*       Slots_;
+  i32       Index_;
+  i32       SlotCount_;
+
+  constexpr bool IsFull(i32 const index) const
+  {
+    return Ctrl_[index / Private::HashMapGroup::Slots * 16 + index % Private::HashMapGroup::Slots] != Private::HashMapGroup::Empty;
+  }
+
+  constexpr void SkipEmptySlots()
+  {
+    while (Index_ < SlotCount_ && !IsFull(Index_))
+      ++Index_;
+  }
+
+public:
+  constexpr HashMapIterator()
+      : HashMapIterator(nullptr, nullptr, 0, 0)
+  {
+  }
+
+  constexpr HashMapIterator(u8 const* Ctrl, KV* Slots, i32 const Index, i32 const SlotCount)
+      : Ctrl_(Ctrl)
+      , Slots_(Slots)
+      , Index_(Index)
+      , SlotCount_(SlotCount)
+  {
+    SkipEmptySlots();
+  }
+
+  constexpr HashMapIterator& operator++()
+  {
+    ++Index_;
+    SkipEmptySlots();
+    return *this;
+  }
+
+  constexpr HashMapIterator operator++(i32)
+  {
+    HashMapIterator cpy(*this);
+    ++(*this);
+    return cpy;
+  }
+
+  constexpr decltype(auto) operator*() const
+  {
+    KV& item = Slots_[Index_];
+    if constexpr (Kind == Private::KeyValueIterator)
+      return Private::KeyValueRef<Key, Value>{item.Key_, item.Value_};
+    else if constexpr (Kind == Private::KeyIterator)
+      return static_cast<Key&>(item.Key_);
+    else
+      return static_cast<Value&>(item.Value_);
+  }
+
+  constexpr bool operator==(HashMapIterator other) const
+  {
+    return Index_ == other.Index_;
+  }
+};
+
+template <typename KV, typename Key, typename Value, int Kind>
+class HashMapFakeContainer
+{
+  u8 const* Ctrl_;
+  KV*       Slots_;
+  i32       SlotCount_;
+
+public:
+  HashMapFakeContainer(u8 const* Ctrl, KV* Slots, i32 const SlotCount)
+      : Ctrl_(Ctrl)
+      , Slots_(Slots)
+      , SlotCount_(SlotCount)
+  {
+  }
+
+  constexpr decltype(auto) begin() const
+  {
+    return HashMapIterator<KV, Key, Value, Kind>{Ctrl_, Slots_, 0, SlotCount_};
+  }
+
+  constexpr decltype(auto) end() const
+  {
+    return HashMapIterator<KV, Key, Value, Kind>{Ctrl_, Slots_, SlotCount_, SlotCount_};
+  }
+};
+} // namespace Core
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Container/Vector.h>
+#include <cstring>
+#include <iterator>
+
+namespace Core
+{
+namespace Private
+{
+// Serves a single block from an inline buffer, anything else goes to the parent allocator.
+// Neither movable nor copyable, as the buffer lives in the owner.
+template <i32 Bytes, i32 Alignment>
+class InlineBufferAllocator final : public IAllocator
+{
+  alignas(Alignment) u8 Mem_[Bytes];
+  IAllocator* Parent_;
+  bool        InUse_;
+
+public:
+  explicit InlineBufferAllocator(IAllocator* parent)
+      : Parent_(parent)
+      , InUse_(false)
+  {
+    checkf(parent, "Invalid parent allocator!");
+  }
+
+  InlineBufferAllocator(InlineBufferAllocator const&)            = delete;
+  InlineBufferAllocator& operator=(InlineBufferAllocator const&) = delete;
+
+  IAllocator* Parent() const
+  {
+    return Parent_;
+  }
+
+  bool Owns(void const* p) const
+  {
+    return p == Mem_;
+  }
+
+  // clang-format off
+  // Inherited via IAllocator
+  __declspec(allocator) __declspec(restrict) void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags = AllocFlags::Uninitialized) override
+  {
+    if (InUse_ || size > Bytes || alignment > Alignment)
+      return Parent_->Alloc(size, alignment, flags);
+
+    InUse_ = true;
+    if (flags == AllocFlags::Zeroed)
+      std::memset(Mem_, 0, (u64)size);
+    return Mem_;
+  }
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* Realloc(void* p, i64 const size, i32 const alignment) override
+  {
+    if (!Owns(p))
+      return Parent_->Realloc(p, size, alignment);
+    return size <= Bytes ? p : nullptr;
+  }
+  __declspec(noalias) void Free(void* p, i32 const alignment) override
+  {
+    if (Owns(p))
+      InUse_ = false;
+    else
+      Parent_->Free(p, alignment);
+  }
+  __declspec(allocator) __declspec(restrict) __declspec(noalias) void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment) override
+  {
+    if (p && !Owns(p))
+      return Parent_->ReallocSized(p, oldSize, size, alignment);
+    return Realloc(p, size, alignment);
+  }
+  __declspec(noalias) void FreeSized(void* p, i64 const size, i32 const alignment) override
+  {
+    if (p && !Owns(p))
+      Parent_->FreeSized(p, size, alignment);
+    else
+      Free(p, alignment);
+  }
+  bool IsMovable() override
+  {
+    return false;
+  }
+  bool IsCopyable() override
+  {
+    return false;
+  }
+  bool OwnedByContainer() override
+  {
+    return false;
+  }
+  //clang-format on
+};
+
+// Constructed before the Vector base of InlineVector, which allocates from it.
+template <typename T, i32 N>
+struct InlineVectorStorage
+{
+  InlineBufferAllocator<N * (i32)sizeof(T), (i32)alignof(T)> InlineAllocator_;
+
+  explicit InlineVectorStorage(IAllocator* parent)
+      : InlineAllocator_(parent)
+  {
+  }
+};
+} // namespace Private
+
+// Vector storing up to N elements inside the object, and spilling to the parent allocator past that.
+// Same API as Vector, pointers to the elements are invalidated by moves as the inline buffer can't be stolen.
+template <typename T, i32 N>
+class InlineVector : private Private::InlineVectorStorage<T, N>
+    , public Vector<T>
+{
+  static_assert(N > 0, "InlineVector needs at least one inline element.");
+
+  using Storage = Private::InlineVectorStorage<T, N>;
+  using Base    = Vector<T>;
+
+public:
+  InlineVector(IAllocator* parent = GetGlobalAllocator())
+      : Storage(parent)
+      , Base(&this->InlineAllocator_)
+  {
+    Base::Reserve(N);
+  }
+
+  InlineVector(i32 const initialSize, IAllocator* parent = GetGlobalAllocator())
+      : InlineVector(parent)
+  {
+    Base::Resize(initialSize);
+  }
+
+  template <typename U = T>
+  InlineVector(std::initializer_list<U> init, IAllocator* parent = GetGlobalAllocator())
+      : InlineVector(parent)
+  {
+    Base::Assign(init.begin(), init.end());
+  }
+
+  template <std::input_iterator Iterator>
+  InlineVector(Iterator begin, Iterator end, IAllocator* parent = GetGlobalAllocator())
+      : InlineVector(parent)
+  {
+    Base::Assign(begin, end);
+  }
+
+  InlineVector(InlineVector const& other)
+      : InlineVector(other.begin(), other.end(), other.InlineAllocator_.Parent())
+  {
+  }
+
+  InlineVector(InlineVector&& other)
+      : InlineVector(other.InlineAllocator_.Parent())
+  {
+    *this = std::move(other);
+  }
+
+  InlineVector& operator=(InlineVector const& other)
+  {
+    if (this != &other)
+      Base::Assign(other.begin(), other.end());
+    return *this;
+  }
+
+  InlineVector& operator=(InlineVector&& other)
+  {
+    if (this != &other)
+    {
+      Base::Assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+      other.Clear();
+    }
+    return *this;
+  }
+
+  // True while the elements live in the inline buffer.
+  bool IsInline() const
+  {
+    return this->InlineAllocator_.Owns(Base::Data());
+  }
+
+  void Swap(InlineVector& other)
+  {
+    InlineVector tmp = std::move(other);
+    other            = std::move(*this);
+    *this            = std::move(tmp);
+  }
+};
+
+// Adapter for containers taking their storage as a template template parameter,
+// e.g. CompactFlatMap<Key, Value, InlineStorage<4>::Type>.
+template <i32 N>
+struct InlineStorage
+{
+  template <typename T>
+  using Type = InlineVector<T, N>;
+};
+} // namespace Core
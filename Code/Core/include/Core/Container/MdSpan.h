@@ -0,0 +1,359 @@
+#pragma once
+
+#include <Core/Assert/Assert.h>
+#include <Core/Container/Span.h>
+#include <Core/Container/StridedSpan.h>
+#include <Core/Definitions.h>
+#include <bit>
+#include <type_traits>
+
+namespace Core
+{
+// Layouts map the indices of an MdSpan to an offset from its data, in items.
+// Indices go from the slowest to the fastest dimension, e.g. (y, x) for an image.
+
+// Row-major order, the last index is the fastest.
+// Every dimension keeps its own stride, so a window or a column of a row-major array stays in this layout.
+struct LayoutRowMajor
+{
+  template <i32 Rank>
+  class Mapping
+  {
+    i32 Extents_[Rank];
+    i64 Strides_[Rank];
+
+  public:
+    constexpr Mapping()
+        : Extents_{}
+        , Strides_{}
+    {
+    }
+
+    // Packed items.
+    constexpr explicit Mapping(i32 const (&extents)[Rank])
+    {
+      i64 stride = 1;
+      for (i32 dim = Rank - 1; dim >= 0; --dim)
+      {
+        checkf(extents[dim] >= 0, "MdSpan extents shall be positive.");
+        Extents_[dim] = extents[dim];
+        Strides_[dim] = stride;
+        stride *= extents[dim];
+      }
+    }
+
+    constexpr Mapping(i32 const (&extents)[Rank], i64 const (&strides)[Rank])
+    {
+      for (i32 dim = 0; dim < Rank; ++dim)
+      {
+        checkf(extents[dim] >= 0, "MdSpan extents shall be positive.");
+        Extents_[dim] = extents[dim];
+        Strides_[dim] = strides[dim];
+      }
+    }
+
+    constexpr i32 Extent(i32 const dim) const
+    {
+      return Extents_[dim];
+    }
+
+    constexpr i64 Stride(i32 const dim) const
+    {
+      return Strides_[dim];
+    }
+
+    constexpr i64 operator()(i32 const (&indices)[Rank]) const
+    {
+      i64 offset = 0;
+      for (i32 dim = 0; dim < Rank; ++dim)
+        offset += indices[dim] * Strides_[dim];
+      return offset;
+    }
+
+    constexpr bool IsContiguous() const
+    {
+      i64 stride = 1;
+      for (i32 dim = Rank - 1; dim >= 0; --dim)
+      {
+        if (Extents_[dim] > 1 && Strides_[dim] != stride)
+          return false;
+        stride *= Extents_[dim];
+      }
+      return true;
+    }
+  };
+};
+
+// Square tiles of TileSize x TileSize items stored one after the other, in row-major order both inside a tile
+// and between tiles. Keeps 2D neighbours close in memory, e.g. for per-tile passes over a screen or a heightmap.
+// The storage is rounded up to whole tiles.
+template <i32 TileSize>
+struct LayoutTiled
+{
+  static_assert(TileSize > 0 && std::has_single_bit(u32(TileSize)), "LayoutTiled tile size shall be a power of 2.");
+
+  inline static constexpr i32 TileExtent = TileSize;
+  inline static constexpr i32 TileShift  = std::countr_zero(u32(TileSize));
+  inline static constexpr i32 TileMask   = TileSize - 1;
+  inline static constexpr i32 TileItems  = TileSize * TileSize;
+
+  template <i32 Rank>
+  class Mapping
+  {
+    static_assert(Rank == 2, "LayoutTiled only maps 2D arrays.");
+
+    i32 Extents_[2];
+    i32 TilesX_;
+
+  public:
+    constexpr Mapping()
+        : Extents_{}
+        , TilesX_(0)
+    {
+    }
+
+    constexpr explicit Mapping(i32 const (&extents)[2])
+        : Extents_{extents[0], extents[1]}
+        , TilesX_((extents[1] + TileMask) >> TileShift)
+    {
+      checkf(extents[0] >= 0 && extents[1] >= 0, "MdSpan extents shall be positive.");
+    }
+
+    constexpr i32 Extent(i32 const dim) const
+    {
+      return Extents_[dim];
+    }
+
+    // Tiles along a dimension, the last one may be partially used.
+    constexpr i32 TileCount(i32 const dim) const
+    {
+      return (Extents_[dim] + TileMask) >> TileShift;
+    }
+
+    // Items to allocate for the whole array, padding of the edge tiles included.
+    constexpr i64 StorageSize() const
+    {
+      return (i64)TileCount(0) * TileCount(1) * TileItems;
+    }
+
+    constexpr i64 operator()(i32 const (&indices)[2]) const
+    {
+      i32 const y = indices[0];
+      i32 const x = indices[1];
+      i64 const tile = (i64)(y >> TileShift) * TilesX_ + (x >> TileShift);
+      return tile * TileItems + ((y & TileMask) << TileShift) + (x & TileMask);
+    }
+  };
+};
+
+// Non-owning multidimensional view, e.g. MdSpan<f32, 2>(heights, rows, columns) then heights(y, x).
+template <typename T, i32 Rank, typename Layout = LayoutRowMajor>
+class MdSpan
+{
+  static_assert(Rank > 0, "MdSpan needs at least one dimension.");
+
+public:
+  using MappingType = typename Layout::template Mapping<Rank>;
+
+private:
+  T*          Data_;
+  MappingType Mapping_;
+
+  inline static constexpr bool IsRowMajor = std::is_same_v<Layout, LayoutRowMajor>;
+
+  template <i32 Dim, typename Fn>
+  constexpr void ForEachIn(T* base, Fn& visit) const
+  {
+    i32 const extent = Mapping_.Extent(Dim);
+    i64 const stride = Mapping_.Stride(Dim);
+    if constexpr (Dim == Rank - 1)
+    {
+      // Kept apart so the packed case is a plain loop the compiler can vectorize
+      if (stride == 1)
+      {
+        for (i32 i = 0; i < extent; ++i)
+          visit(base[i]);
+      }
+      else
+      {
+        for (i32 i = 0; i < extent; ++i)
+          visit(base[i * stride]);
+      }
+    }
+    else
+    {
+      for (i32 i = 0; i < extent; ++i)
+        ForEachIn<Dim + 1>(base + i * stride, visit);
+    }
+  }
+
+public:
+  constexpr MdSpan()
+      : Data_(nullptr)
+      , Mapping_()
+  {
+  }
+
+  template <typename... Extents>
+    requires(sizeof...(Extents) == Rank && (std::is_integral_v<Extents> && ...))
+  constexpr MdSpan(T* data, Extents... extents)
+      : Data_(data)
+      , Mapping_({i32(extents)...})
+  {
+  }
+
+  constexpr MdSpan(T* data, MappingType const& mapping)
+      : Data_(data)
+      , Mapping_(mapping)
+  {
+  }
+
+  constexpr T* Data() const
+  {
+    return Data_;
+  }
+
+  constexpr MappingType const& Mapping() const
+  {
+    return Mapping_;
+  }
+
+  constexpr i32 Extent(i32 const dim) const
+  {
+    checkf(u32(dim) < u32(Rank), "MdSpan dimension out of range.");
+    return Mapping_.Extent(dim);
+  }
+
+  // Number of items in the view.
+  constexpr i64 Size() const
+  {
+    i64 size = 1;
+    for (i32 dim = 0; dim < Rank; ++dim)
+      size *= Mapping_.Extent(dim);
+    return size;
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Size() == 0;
+  }
+
+  template <typename... Indices>
+    requires(sizeof...(Indices) == Rank && (std::is_integral_v<Indices> && ...))
+  constexpr T& operator()(Indices... indices) const
+  {
+    i32 const index[Rank] = {i32(indices)...};
+    for (i32 dim = 0; dim < Rank; ++dim)
+      checkf(u32(index[dim]) < u32(Mapping_.Extent(dim)), "MdSpan operator() out-of-bounds access.");
+    return Data_[Mapping_(index)];
+  }
+
+  // Calls `visit(T&)` on every item, in memory order.
+  template <typename Fn>
+  constexpr void ForEach(Fn&& visit) const
+  {
+    if constexpr (IsRowMajor)
+    {
+      if (!IsEmpty())
+        ForEachIn<0>(Data_, visit);
+    }
+    else
+    {
+      for (i32 tileY = 0; tileY < Mapping_.TileCount(0); ++tileY)
+        for (i32 tileX = 0; tileX < Mapping_.TileCount(1); ++tileX)
+          Tile(tileY, tileX).ForEach(visit);
+    }
+  }
+
+  // Row-major views
+
+  constexpr i64 Stride(i32 const dim) const
+    requires IsRowMajor
+  {
+    checkf(u32(dim) < u32(Rank), "MdSpan dimension out of range.");
+    return Mapping_.Stride(dim);
+  }
+
+  constexpr bool IsContiguous() const
+    requires IsRowMajor
+  {
+    return Mapping_.IsContiguous();
+  }
+
+  constexpr Span<T> AsSpan() const
+    requires IsRowMajor
+  {
+    checkf(IsContiguous(), "MdSpan AsSpan() called on a non-contiguous view.");
+    return Span<T>(Data_, i32(Size()));
+  }
+
+  // The items from `offsets`, `extents` long in each dimension.
+  constexpr MdSpan SubView(i32 const (&offsets)[Rank], i32 const (&extents)[Rank]) const
+    requires IsRowMajor
+  {
+    i64 strides[Rank];
+    for (i32 dim = 0; dim < Rank; ++dim)
+    {
+      checkf(0 <= offsets[dim] && 0 <= extents[dim] && offsets[dim] + extents[dim] <= Mapping_.Extent(dim), "MdSpan SubView out of range.");
+      strides[dim] = Mapping_.Stride(dim);
+    }
+    return MdSpan(Data_ + Mapping_(offsets), MappingType(extents, strides));
+  }
+
+  // The items whose first index is `index`, e.g. a row of a 2D array.
+  constexpr MdSpan<T, Rank - 1> Slice(i32 const index) const
+    requires(IsRowMajor && Rank > 1)
+  {
+    checkf(u32(index) < u32(Mapping_.Extent(0)), "MdSpan Slice(index) out of range.");
+    i32 extents[Rank - 1];
+    i64 strides[Rank - 1];
+    for (i32 dim = 1; dim < Rank; ++dim)
+    {
+      extents[dim - 1] = Mapping_.Extent(dim);
+      strides[dim - 1] = Mapping_.Stride(dim);
+    }
+    using SliceMapping = typename MdSpan<T, Rank - 1>::MappingType;
+    return MdSpan<T, Rank - 1>(Data_ + index * Mapping_.Stride(0), SliceMapping(extents, strides));
+  }
+
+  constexpr StridedSpan<T> AsStridedSpan() const
+    requires(IsRowMajor && Rank == 1)
+  {
+    return StridedSpan<T>(Data_, Mapping_.Extent(0), i32(Mapping_.Stride(0) * (i64)sizeof(T)));
+  }
+
+  constexpr StridedSpan<T> Row(i32 const y) const
+    requires(IsRowMajor && Rank == 2)
+  {
+    return Slice(y).AsStridedSpan();
+  }
+
+  constexpr StridedSpan<T> Column(i32 const x) const
+    requires(IsRowMajor && Rank == 2)
+  {
+    checkf(u32(x) < u32(Mapping_.Extent(1)), "MdSpan Column(x) out of range.");
+    return StridedSpan<T>(Data_ + x * Mapping_.Stride(1), Mapping_.Extent(0), i32(Mapping_.Stride(0) * (i64)sizeof(T)));
+  }
+
+  // Tiled views
+
+  constexpr i32 TileCount(i32 const dim) const
+    requires(!IsRowMajor)
+  {
+    return Mapping_.TileCount(dim);
+  }
+
+  // The used part of a tile, as a row-major view.
+  constexpr MdSpan<T, 2> Tile(i32 const tileY, i32 const tileX) const
+    requires(!IsRowMajor)
+  {
+    checkf(u32(tileY) < u32(TileCount(0)) && u32(tileX) < u32(TileCount(1)), "MdSpan Tile(tileY, tileX) out of range.");
+    i32 const tileSize = Layout::TileExtent;
+    i32 const y        = tileY * tileSize;
+    i32 const x        = tileX * tileSize;
+    i32 const height   = Mapping_.Extent(0) - y < tileSize ? Mapping_.Extent(0) - y : tileSize;
+    i32 const width    = Mapping_.Extent(1) - x < tileSize ? Mapping_.Extent(1) - x : tileSize;
+    return MdSpan<T, 2>(Data_ + Mapping_({y, x}), LayoutRowMajor::Mapping<2>({height, width}, {i64(tileSize), 1}));
+  }
+};
+} // namespace Core
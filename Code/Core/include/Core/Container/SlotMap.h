@@ -0,0 +1,224 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Container/Vector.h>
+#include <Core/Definitions.h>
+#include <utility>
+
+namespace Core
+{
+// Weak reference to an element of a SlotMap, which stays safe to use after the element is erased.
+// Live elements have an odd generation, so the default constructed handle never refers to anything.
+struct SlotMapHandle
+{
+  u32 Index_{};
+  u32 Generation_{};
+
+  constexpr bool IsNull() const
+  {
+    return Generation_ == 0;
+  }
+
+  constexpr u64 ToU64() const
+  {
+    return u64(Generation_) << 32 | Index_;
+  }
+
+  static constexpr SlotMapHandle FromU64(u64 const packed)
+  {
+    return SlotMapHandle{u32(packed), u32(packed >> 32)};
+  }
+
+  constexpr bool operator==(SlotMapHandle const other) const
+  {
+    return Index_ == other.Index_ && Generation_ == other.Generation_;
+  }
+
+  constexpr bool operator!=(SlotMapHandle const other) const
+  {
+    return !operator==(other);
+  }
+
+  u64 CalculateHash() const
+  {
+    return ToU64();
+  }
+};
+
+// Unordered container handing out generational handles to its elements.
+// Insert, Erase and Find are O(1), elements are kept packed so iterating them is linear in memory.
+// Erasing moves the last element in the freed spot, invalidating pointers but not handles.
+template <typename T>
+class SlotMap
+{
+  struct Slot
+  {
+    u32 Dense_;      // Index in Values_ while alive, next free slot otherwise
+    u32 Generation_; // Bumped on insert and erase, odd while alive
+  };
+
+  inline static constexpr u32 EndOfFreeList = ~0u;
+
+  Vector<T>    Values_;
+  Vector<u32>  DenseToSlot_;
+  Vector<Slot> Slots_;
+  u32          FreeHead_;
+
+  constexpr Slot const* FindSlot(SlotMapHandle const handle) const
+  {
+    if (handle.Index_ >= u32(Slots_.Size()))
+      return nullptr;
+
+    Slot const& slot = Slots_[i32(handle.Index_)];
+    return slot.Generation_ == handle.Generation_ && (slot.Generation_ & 1) ? &slot : nullptr;
+  }
+
+public:
+  constexpr SlotMap(IAllocator* allocator = GetGlobalAllocator())
+      : Values_(allocator)
+      , DenseToSlot_(allocator)
+      , Slots_(allocator)
+      , FreeHead_(EndOfFreeList)
+  {
+  }
+
+  constexpr IAllocator* Allocator() const
+  {
+    return Values_.Allocator();
+  }
+
+  constexpr void Reserve(i32 const capacity)
+  {
+    Values_.Reserve(capacity);
+    DenseToSlot_.Reserve(capacity);
+    Slots_.Reserve(capacity);
+  }
+
+  template <typename... Args>
+  constexpr SlotMapHandle Emplace(Args&&... args)
+  {
+    u32 index;
+    if (FreeHead_ != EndOfFreeList)
+    {
+      index     = FreeHead_;
+      FreeHead_ = Slots_[i32(index)].Dense_;
+    }
+    else
+    {
+      index = u32(Slots_.Size());
+      Slots_.EmplaceBack(Slot{EndOfFreeList, 0});
+    }
+
+    Slot& slot       = Slots_[i32(index)];
+    slot.Dense_      = u32(Values_.Size());
+    slot.Generation_ = slot.Generation_ + 1;
+    Values_.EmplaceBack(std::forward<Args>(args)...);
+    DenseToSlot_.EmplaceBack(index);
+    return SlotMapHandle{index, slot.Generation_};
+  }
+
+  constexpr SlotMapHandle Insert(T const& value)
+  {
+    return Emplace(value);
+  }
+
+  constexpr SlotMapHandle Insert(T&& value)
+  {
+    return Emplace(std::move(value));
+  }
+
+  // Returns false if the handle is stale.
+  constexpr bool Erase(SlotMapHandle const handle)
+  {
+    if (!FindSlot(handle))
+      return false;
+
+    Slot&     slot  = Slots_[i32(handle.Index_)];
+    i32 const dense = i32(slot.Dense_);
+    i32 const last  = Values_.Size() - 1;
+    if (dense != last)
+    {
+      Values_[dense]                          = std::move(Values_[last]);
+      DenseToSlot_[dense]                     = DenseToSlot_[last];
+      Slots_[i32(DenseToSlot_[dense])].Dense_ = u32(dense);
+    }
+    Values_.PopBack();
+    DenseToSlot_.PopBack();
+
+    // Skips the 0 generation on wrap-around, so the null handle stays invalid
+    slot.Generation_ = slot.Generation_ + 1 == 0 ? 2 : slot.Generation_ + 1;
+    slot.Dense_      = FreeHead_;
+    FreeHead_        = handle.Index_;
+    return true;
+  }
+
+  constexpr bool Contains(SlotMapHandle const handle) const
+  {
+    return FindSlot(handle) != nullptr;
+  }
+
+  constexpr T* Find(SlotMapHandle const handle)
+  {
+    Slot const* slot = FindSlot(handle);
+    return slot ? &Values_[i32(slot->Dense_)] : nullptr;
+  }
+
+  constexpr T const* Find(SlotMapHandle const handle) const
+  {
+    Slot const* slot = FindSlot(handle);
+    return slot ? &Values_[i32(slot->Dense_)] : nullptr;
+  }
+
+  // Handle of the element at `denseIndex` in the iteration order.
+  constexpr SlotMapHandle HandleAt(i32 const denseIndex) const
+  {
+    u32 const index = DenseToSlot_[denseIndex];
+    return SlotMapHandle{index, Slots_[i32(index)].Generation_};
+  }
+
+  // Erases every element, outstanding handles become stale.
+  constexpr void Clear()
+  {
+    while (!Values_.IsEmpty())
+      Erase(HandleAt(Values_.Size() - 1));
+  }
+
+  constexpr i32 Size() const
+  {
+    return Values_.Size();
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Values_.IsEmpty();
+  }
+
+  constexpr T* Data()
+  {
+    return Values_.Data();
+  }
+  constexpr T const* Data() const
+  {
+    return Values_.Data();
+  }
+
+  constexpr T* begin()
+  {
+    return Values_.begin();
+  }
+  constexpr T const* begin() const
+  {
+    return Values_.begin();
+  }
+
+  constexpr T* end()
+  {
+    return Values_.end();
+  }
+  constexpr T const* end() const
+  {
+    return Values_.end();
+  }
+};
+} // namespace Core
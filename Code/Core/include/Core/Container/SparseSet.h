@@ -0,0 +1,168 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Container/Span.h>
+#include <Core/Container/Vector.h>
+#include <Core/Definitions.h>
+#include <utility>
+
+namespace Core
+{
+// Maps u32 keys (e.g. entity indices) to values kept packed in a dense array.
+// The sparse side is split in pages allocated on first use, so sparse key ranges stay cheap.
+// TryEmplace, TryRemove and Find are O(1), removal swaps the last element in, so the order isn't stable.
+template <typename T, i32 PageSizeLog2 = 10>
+class SparseSet
+{
+  static_assert(PageSizeLog2 > 0 && PageSizeLog2 < 31, "Invalid SparseSet page size.");
+
+  inline static constexpr i32 PageSize = 1 << PageSizeLog2;
+  inline static constexpr u32 Absent   = ~0u;
+
+  Vector<Vector<u32>> Pages_; // Dense index of each key, an empty page has no key
+  Vector<u32>         Keys_;
+  Vector<T>           Values_;
+
+  constexpr u32 DenseIndex(u32 const key) const
+  {
+    i32 const page = i32(key >> PageSizeLog2);
+    if (page >= Pages_.Size() || Pages_[page].IsEmpty())
+      return Absent;
+    return Pages_[page][i32(key & (PageSize - 1))];
+  }
+
+  constexpr u32& DenseSlot(u32 const key)
+  {
+    i32 const page = i32(key >> PageSizeLog2);
+    // Pages are created with the set's allocator, a default constructed one would use the global allocator
+    while (page >= Pages_.Size())
+      Pages_.EmplaceBack(Allocator());
+    if (Pages_[page].IsEmpty())
+      Pages_[page].Assign(PageSize, Absent);
+    return Pages_[page][i32(key & (PageSize - 1))];
+  }
+
+public:
+  constexpr SparseSet(IAllocator* allocator = GetGlobalAllocator())
+      : Pages_(allocator)
+      , Keys_(allocator)
+      , Values_(allocator)
+  {
+  }
+
+  constexpr IAllocator* Allocator() const
+  {
+    return Values_.Allocator();
+  }
+
+  // Reserves the dense side only.
+  constexpr void Reserve(i32 const capacity)
+  {
+    Keys_.Reserve(capacity);
+    Values_.Reserve(capacity);
+  }
+
+  // Returns nullptr if `key` is already in the set.
+  template <typename... Args>
+  constexpr T* TryEmplace(u32 const key, Args&&... args)
+  {
+    checkf(key != Absent, "Invalid SparseSet key.");
+    u32& slot = DenseSlot(key);
+    if (slot != Absent)
+      return nullptr;
+
+    slot = u32(Values_.Size());
+    Keys_.EmplaceBack(key);
+    return Values_.EmplaceBack(std::forward<Args>(args)...);
+  }
+
+  constexpr bool TryRemove(u32 const key)
+  {
+    u32 const dense = DenseIndex(key);
+    if (dense == Absent)
+      return false;
+
+    i32 const last = Values_.Size() - 1;
+    if (i32(dense) != last)
+    {
+      Values_[i32(dense)]    = std::move(Values_[last]);
+      Keys_[i32(dense)]      = Keys_[last];
+      DenseSlot(Keys_[last]) = dense;
+    }
+    Values_.PopBack();
+    Keys_.PopBack();
+    DenseSlot(key) = Absent;
+    return true;
+  }
+
+  constexpr bool Contains(u32 const key) const
+  {
+    return DenseIndex(key) != Absent;
+  }
+
+  constexpr T* Find(u32 const key)
+  {
+    u32 const dense = DenseIndex(key);
+    return dense == Absent ? nullptr : &Values_[i32(dense)];
+  }
+
+  constexpr T const* Find(u32 const key) const
+  {
+    u32 const dense = DenseIndex(key);
+    return dense == Absent ? nullptr : &Values_[i32(dense)];
+  }
+
+  // Keeps the sparse pages, so re-adding the same keys doesn't allocate.
+  constexpr void Clear()
+  {
+    for (u32 const key : Keys_)
+      DenseSlot(key) = Absent;
+    Keys_.Clear();
+    Values_.Clear();
+  }
+
+  constexpr i32 Size() const
+  {
+    return Values_.Size();
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Values_.IsEmpty();
+  }
+
+  // Keys, in the same order as the values.
+  constexpr Span<u32 const> Keys() const
+  {
+    return Span<u32 const>(Keys_.Data(), Keys_.Size());
+  }
+
+  constexpr T* Data()
+  {
+    return Values_.Data();
+  }
+  constexpr T const* Data() const
+  {
+    return Values_.Data();
+  }
+
+  constexpr T* begin()
+  {
+    return Values_.begin();
+  }
+  constexpr T const* begin() const
+  {
+    return Values_.begin();
+  }
+
+  constexpr T* end()
+  {
+    return Values_.end();
+  }
+  constexpr T const* end() const
+  {
+    return Values_.end();
+  }
+};
+} // namespace Core
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <Core/Assert/Assert.h>
+#include <Core/Container/Span.h>
+#include <Core/Definitions.h>
+#include <iterator>
+#include <type_traits>
+
+namespace Core
+{
+namespace Private
+{
+// Byte pointer with the constness of T, the stride isn't always a multiple of sizeof(T).
+template <typename T>
+using StridedBytePtr = std::conditional_t<std::is_const_v<T>, u8 const*, u8*>;
+} // namespace Private
+
+template <typename T>
+class StridedIterator
+{
+  using BytePtr = Private::StridedBytePtr<T>;
+
+  BytePtr Ptr_;
+  i32     Stride_;
+
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type        = std::remove_cv_t<T>;
+  using difference_type   = i64;
+  using pointer           = T*;
+  using reference         = T&;
+
+  constexpr StridedIterator()
+      : Ptr_(nullptr)
+      , Stride_(0)
+  {
+  }
+
+  constexpr StridedIterator(BytePtr ptr, i32 const stride)
+      : Ptr_(ptr)
+      , Stride_(stride)
+  {
+  }
+
+  constexpr T& operator*() const
+  {
+    return *(T*)Ptr_;
+  }
+
+  constexpr T* operator->() const
+  {
+    return (T*)Ptr_;
+  }
+
+  constexpr T& operator[](i64 const n) const
+  {
+    return *(T*)(Ptr_ + n * Stride_);
+  }
+
+  constexpr StridedIterator& operator++()
+  {
+    Ptr_ += Stride_;
+    return *this;
+  }
+
+  constexpr StridedIterator operator++(i32)
+  {
+    StridedIterator tmp = *this;
+    Ptr_ += Stride_;
+    return tmp;
+  }
+
+  constexpr StridedIterator& operator--()
+  {
+    Ptr_ -= Stride_;
+    return *this;
+  }
+
+  constexpr StridedIterator operator--(i32)
+  {
+    StridedIterator tmp = *this;
+    Ptr_ -= Stride_;
+    return tmp;
+  }
+
+  constexpr StridedIterator& operator+=(i64 const n)
+  {
+    Ptr_ += n * Stride_;
+    return *this;
+  }
+
+  constexpr StridedIterator& operator-=(i64 const n)
+  {
+    Ptr_ -= n * Stride_;
+    return *this;
+  }
+
+  constexpr friend StridedIterator operator+(StridedIterator it, i64 const n)
+  {
+    return it += n;
+  }
+
+  constexpr friend StridedIterator operator+(i64 const n, StridedIterator it)
+  {
+    return it += n;
+  }
+
+  constexpr friend StridedIterator operator-(StridedIterator it, i64 const n)
+  {
+    return it -= n;
+  }
+
+  constexpr friend i64 operator-(StridedIterator const& lhs, StridedIterator const& rhs)
+  {
+    return lhs.Stride_ == 0 ? 0 : (lhs.Ptr_ - rhs.Ptr_) / lhs.Stride_;
+  }
+
+  constexpr bool operator==(StridedIterator const& other) const
+  {
+    return Ptr_ == other.Ptr_;
+  }
+
+  constexpr auto operator<=>(StridedIterator const& other) const
+  {
+    // Negative strides walk down the memory
+    return Stride_ >= 0 ? Ptr_ <=> other.Ptr_ : other.Ptr_ <=> Ptr_;
+  }
+};
+
+// Non-owning view of `Size()` items spaced `Stride()` bytes apart, e.g. one field of an array of structs.
+// The stride may be any multiple of alignof(T), including negative ones to walk backward.
+template <typename T>
+class StridedSpan
+{
+  using BytePtr = Private::StridedBytePtr<T>;
+
+  BytePtr Data_;
+  i32     Size_;
+  i32     Stride_;
+
+public:
+  constexpr StridedSpan()
+      : Data_(nullptr)
+      , Size_(0)
+      , Stride_((i32)sizeof(T))
+  {
+  }
+
+  constexpr StridedSpan(T* data, i32 const count, i32 const stride = (i32)sizeof(T))
+      : Data_((BytePtr)data)
+      , Size_(count)
+      , Stride_(stride)
+  {
+    checkf(count >= 0, "StridedSpan size shall be positive.");
+    checkf(stride % (i32)alignof(T) == 0, "StridedSpan stride shall keep the items aligned.");
+  }
+
+  template <typename U, i32 N>
+    requires std::is_convertible_v<U (*)[], T (*)[]>
+  constexpr StridedSpan(Span<U, N> span)
+      : StridedSpan(span.Data(), span.Size())
+  {
+  }
+
+  constexpr bool IsEmpty() const
+  {
+    return Size_ == 0;
+  }
+
+  constexpr i32 Size() const
+  {
+    return Size_;
+  }
+
+  // Distance between two consecutive items, in bytes.
+  constexpr i32 Stride() const
+  {
+    return Stride_;
+  }
+
+  constexpr T* Data() const
+  {
+    return (T*)Data_;
+  }
+
+  // True if the items are packed, AsSpan is then valid.
+  constexpr bool IsContiguous() const
+  {
+    return Stride_ == (i32)sizeof(T) || Size_ <= 1;
+  }
+
+  constexpr Span<T> AsSpan() const
+  {
+    checkf(IsContiguous(), "StridedSpan AsSpan() called on a non-contiguous view.");
+    return Span<T>((T*)Data_, Size_);
+  }
+
+  constexpr T& operator[](i32 const index) const
+  {
+    checkf(u32(index) < u32(Size_), "StridedSpan operator[] out-of-bounds access.");
+    return *(T*)(Data_ + (i64)index * Stride_);
+  }
+
+  constexpr StridedIterator<T> begin() const
+  {
+    return StridedIterator<T>(Data_, Stride_);
+  }
+
+  constexpr StridedIterator<T> end() const
+  {
+    return StridedIterator<T>(Data_ + (i64)Size_ * Stride_, Stride_);
+  }
+
+  constexpr StridedSpan First(i32 const count) const
+  {
+    checkf(0 <= count && count <= Size_, "StridedSpan First(count) out of range.");
+    return StridedSpan((T*)Data_, count, Stride_);
+  }
+
+  constexpr StridedSpan Last(i32 const count) const
+  {
+    checkf(0 <= count && count <= Size_, "StridedSpan Last(count) out of range.");
+    return StridedSpan((T*)(Data_ + (i64)(Size_ - count) * Stride_), count, Stride_);
+  }
+
+  constexpr StridedSpan SubSpan(i32 const offset, i32 const count) const
+  {
+    checkf(0 <= offset && 0 <= count && offset + count <= Size_, "StridedSpan SubSpan(offset, count) out of range.");
+    return StridedSpan((T*)(Data_ + (i64)offset * Stride_), count, Stride_);
+  }
+
+  // Every `step`-th item, starting with the first one.
+  constexpr StridedSpan Every(i32 const step) const
+  {
+    checkf(step > 0, "StridedSpan Every(step) needs a positive step.");
+    return StridedSpan((T*)Data_, (Size_ + step - 1) / step, Stride_ * step);
+  }
+
+  constexpr StridedSpan Reversed() const
+  {
+    if (Size_ == 0)
+      return *this;
+    return StridedSpan((T*)(Data_ + (i64)(Size_ - 1) * Stride_), Size_, -Stride_);
+  }
+
+  // Calls `visit(T&)` on every item in order. Packed views run a plain pointer loop the compiler can vectorize.
+  template <typename Fn>
+  constexpr void ForEach(Fn&& visit) const
+  {
+    if (Stride_ == (i32)sizeof(T))
+    {
+      T* const items = (T*)Data_;
+      for (i32 i = 0; i < Size_; ++i)
+        visit(items[i]);
+    }
+    else
+    {
+      BytePtr item = Data_;
+      for (i32 i = 0; i < Size_; ++i, item += Stride_)
+        visit(*(T*)item);
+    }
+  }
+};
+
+template <typename T, i32 N>
+StridedSpan(Span<T, N>) -> StridedSpan<T>;
+
+// The `member` field of every item of `items`, e.g. MemberSpan(Span<Transform>(transforms), &Transform::Position_).
+template <typename U, typename Member, typename Class>
+  requires std::is_same_v<std::remove_const_t<U>, Class>
+constexpr auto MemberSpan(Span<U> items, Member Class::*member)
+{
+  using Field = std::conditional_t<std::is_const_v<U>, Member const, Member>;
+  if (items.IsEmpty())
+    return StridedSpan<Field>();
+  return StridedSpan<Field>(&(items.Data()->*member), items.Size(), (i32)sizeof(U));
+}
+} // namespace Core
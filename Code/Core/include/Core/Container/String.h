@@ -5,6 +5,7 @@
 #include <Core/Container/Span.h>
 #include <Core/Container/Vector.h>
 #include <Core/Definitions.h>
+#include <bit>
 #include <cstring>
 #include <memory>
 #include <type_traits>
@@ -208,20 +209,147 @@ public:
   }
 };
 
+// Null-terminated string with small-string optimization: short strings are stored inside the object,
+// in the space otherwise used by the heap pointer, size and capacity.
 template <typename CharT>
 class String
 {
+  static_assert(std::endian::native == std::endian::little, "String's inline layout relies on a little-endian capacity.");
+
   inline static constexpr CharT Terminator = CharT('\0');
 
-  Vector<CharT> Mem_;
+  // Set in the heap capacity, it overlaps the last inline character, which always fits in 7 bits when inline.
+  inline static constexpr u32 HeapFlag = 1u << 31;
+
+  struct HeapStorage
+  {
+    CharT* Data_;
+    i32    Size_;
+    u32    Capacity_; // Excludes the terminator, tagged with HeapFlag
+  };
+
+  // Characters fitting inline, without the terminator.
+  // The last inline slot holds the remaining capacity, so it becomes the terminator when the string is full.
+  inline static constexpr i32 InlineCapacity = i32(sizeof(HeapStorage) / sizeof(CharT)) - 1;
+
+  IAllocator* Allocator_;
+  union
+  {
+    HeapStorage Heap_;
+    CharT       Inline_[InlineCapacity + 1];
+  };
+
+  static_assert(sizeof(HeapStorage) == sizeof(CharT) * (InlineCapacity + 1), "Inline buffer must overlap the heap storage exactly.");
+
+  constexpr bool IsInline() const
+  {
+    return (Heap_.Capacity_ & HeapFlag) == 0;
+  }
+
+  constexpr void SetSize(i32 const newSize)
+  {
+    if (IsInline())
+    {
+      Inline_[newSize]        = Terminator;
+      Inline_[InlineCapacity] = CharT(InlineCapacity - newSize);
+    }
+    else
+    {
+      Heap_.Data_[newSize] = Terminator;
+      Heap_.Size_          = newSize;
+    }
+  }
+
+  // Frees the heap buffer, if any, and goes back to an empty inline string.
+  constexpr void Reset()
+  {
+    if (!IsInline())
+      Allocator_->FreeSized(Heap_.Data_, (Capacity() + 1) * (i64)sizeof(CharT), alignof(CharT));
+    Heap_ = {};
+    SetSize(0);
+  }
+
+  // Makes room for at least `newCapacity` characters plus the terminator, keeping the content.
+  constexpr void Grow(i32 const newCapacity)
+  {
+    i32 const currCapacity = Capacity();
+    if (newCapacity <= currCapacity)
+      return;
+
+    i32 const currSize  = Size();
+    i64 const newBytes  = (newCapacity + 1) * (i64)sizeof(CharT);
+    i64 const currBytes = (currCapacity + 1) * (i64)sizeof(CharT);
+
+    CharT* newMem = nullptr;
+    if (!IsInline())
+      newMem = (CharT*)Allocator_->ReallocSized(Heap_.Data_, currBytes, newBytes, alignof(CharT));
+
+    if (!newMem)
+    {
+      newMem = (CharT*)Allocator_->Alloc(newBytes, alignof(CharT));
+      checkf(newMem, "Couldn't allocate String memory.");
+      std::memcpy(newMem, Data(), (u64)(currSize + 1) * sizeof(CharT));
+      if (!IsInline())
+        Allocator_->FreeSized(Heap_.Data_, currBytes, alignof(CharT));
+    }
+
+    Heap_.Data_     = newMem;
+    Heap_.Size_     = currSize;
+    Heap_.Capacity_ = u32(newCapacity) | HeapFlag;
+  }
+
+  // Like Grow, but with amortized growth for appends.
+  constexpr void GrowForAppend(i32 const newSize)
+  {
+    i32 const currCapacity = Capacity();
+    if (newSize > currCapacity)
+      Grow(newSize > currCapacity * 2 ? newSize : currCapacity * 2);
+  }
+
+  static constexpr void Fill(CharT* dest, i32 const count, CharT const c)
+  {
+    if constexpr (std::same_as<CharT, char>)
+    {
+      std::memset(dest, c, (u64)count);
+    }
+    else
+    {
+      wmemset(dest, c, (u64)count);
+    }
+  }
+
+  constexpr bool Overlaps(StringView<CharT> const view) const
+  {
+    return view.Data() >= Data() && view.Data() < Data() + Size();
+  }
+
+  // Takes over the content of `other`, stealing its heap buffer if the allocator permits.
+  constexpr void MoveFrom(String& other)
+  {
+    if (!other.IsInline() && other.Allocator_->IsMovable())
+    {
+      Heap_      = other.Heap_;
+      Allocator_ = std::exchange(other.Allocator_, GetGlobalAllocator());
+      other.Heap_ = {};
+      other.SetSize(0);
+      return;
+    }
+
+    Allocator_ = other.Allocator_->IsMovable() || other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator();
+    Assign(other.AsView());
+    other.Reset();
+  }
 
 public:
   constexpr String(IAllocator* allocator = GetGlobalAllocator())
-      : Mem_(allocator)
+      : Allocator_(allocator)
+      , Heap_{}
   {
+    checkf(allocator, "Invalid allocator!");
+    SetSize(0);
   }
 
-  constexpr String(i32 const count, char const c, IAllocator* allocator = GetGlobalAllocator())
+  constexpr String(i32 const count, CharT const c, IAllocator* allocator = GetGlobalAllocator())
       : String(allocator)
   {
     Assign(c, count);
@@ -234,113 +362,132 @@ public:
   }
 
   constexpr String(String const& other)
-      : Mem_(other.Mem_)
+      : String(other.AsView(), other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator())
   {
   }
 
   constexpr String(String&& other)
-      : Mem_(std::move(other.Mem_))
+      : String()
   {
+    MoveFrom(other);
+  }
+
+  constexpr ~String()
+  {
+    Reset();
+    if (Allocator_->OwnedByContainer())
+      delete Allocator_;
   }
 
   constexpr String& operator=(String const& other)
   {
-    Mem_ = other.Mem_;
+    if (this != &other)
+    {
+      Reset();
+      Allocator_ = other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator();
+      Assign(other.AsView());
+    }
     return *this;
   }
 
   constexpr String& operator=(String&& other)
   {
-    Mem_ = std::move(other.Mem_);
+    if (this != &other)
+    {
+      Reset();
+      MoveFrom(other);
+    }
     return *this;
   }
 
   constexpr IAllocator* Allocator() const
   {
-    return Mem_.Allocator();
+    return Allocator_;
   }
 
   constexpr bool IsEmpty() const
   {
-    return Mem_.IsEmpty();
+    return Size() == 0;
   }
 
+  // Number of characters, without the terminator.
   constexpr i32 Size() const
   {
-    return Mem_.IsEmpty() ? 0 : Mem_.Size() - 1; // we exclude the terminator
+    return IsInline() ? InlineCapacity - i32(Inline_[InlineCapacity]) : Heap_.Size_;
   }
 
+  // Number of characters that fit without allocating, without the terminator.
   constexpr i32 Capacity() const
   {
-    return Mem_.Capacity();
+    return IsInline() ? InlineCapacity : i32(Heap_.Capacity_ & ~HeapFlag);
   }
 
+  // The size of the characters, terminator included, in bytes.
   constexpr i32 AllocSize() const
   {
-    return Mem_.AllocSize();
+    return (Size() + 1) * (i32)sizeof(CharT);
   }
 
+  // Always valid and null-terminated, even when empty.
   constexpr CharT* Data()
   {
-    return Mem_.Data();
+    return IsInline() ? Inline_ : Heap_.Data_;
   }
   constexpr CharT const* Data() const
   {
-    return Mem_.Data();
-  }
-
-  constexpr CharT** PData()
-  {
-    return Mem_.PData();
-  }
-  constexpr CharT const** PData() const
-  {
-    return Mem_.PData();
+    return IsInline() ? Inline_ : Heap_.Data_;
   }
 
   constexpr CharT* begin()
   {
-    return Mem_.begin();
+    return Data();
   }
   constexpr CharT const* begin() const
   {
-    return Mem_.begin();
+    return Data();
   }
 
+  // Points to the terminator.
   constexpr CharT* end()
   {
-    return Mem_.end();
+    return Data() + Size();
   }
   constexpr CharT const* end() const
   {
-    return Mem_.end();
+    return Data() + Size();
   }
 
   constexpr CharT& Front()
   {
-    return Mem_.Front();
+    checkf(!IsEmpty(), "String is empty, but Front() was called.");
+    return Data()[0];
   }
   constexpr CharT const& Front() const
   {
-    return Mem_.Front();
+    checkf(!IsEmpty(), "String is empty, but Front() was called.");
+    return Data()[0];
   }
 
   constexpr CharT& Back()
   {
-    return Mem_.Back();
+    checkf(!IsEmpty(), "String is empty, but Back() was called.");
+    return Data()[Size() - 1];
   }
   constexpr CharT const& Back() const
   {
-    return Mem_.Back();
+    checkf(!IsEmpty(), "String is empty, but Back() was called.");
+    return Data()[Size() - 1];
   }
 
   constexpr CharT& operator[](i32 const pos)
   {
-    return Mem_[pos];
+    checkf(u32(pos) < u32(Size()), "String operator[] out-of-bounds access.");
+    return Data()[pos];
   }
   constexpr CharT const& operator[](i32 const pos) const
   {
-    return Mem_[pos];
+    checkf(u32(pos) < u32(Size()), "String operator[] out-of-bounds access.");
+    return Data()[pos];
   }
 
   constexpr operator StringView<CharT>() const&
@@ -353,42 +500,89 @@ public:
     return StringView<CharT>(Data(), Size());
   }
 
+  // A trailing terminator in `view` isn't counted as part of the string.
   constexpr void Assign(StringView<CharT> view)
   {
-    bool const needsTerminator = !view.IsEmpty() && view.Back() != Terminator;
-    Mem_.Reserve(view.Size() + (needsTerminator ? 1 : 0));
-    Mem_.Assign(view.begin(), view.end());
-    if (needsTerminator)
-      Mem_.EmplaceBackUnsafe(Terminator);
+    if (!view.IsEmpty() && view.Back() == Terminator)
+      view = view.RemoveSuffix(1);
+
+    if (Overlaps(view))
+    {
+      // Sub-view of ourselves, it can only shrink
+      std::memmove(Data(), view.Data(), (u64)view.AllocSize());
+    }
+    else
+    {
+      if (view.Size() > Capacity())
+        Grow(view.Size());
+      if (!view.IsEmpty())
+        std::memcpy(Data(), view.Data(), (u64)view.AllocSize());
+    }
+    SetSize(view.Size());
   }
 
   constexpr void Assign(CharT const c, i32 const count)
   {
-    bool const needsTerminator = c != Terminator;
-    Mem_.Reserve(count + (needsTerminator ? 1 : 0));
-    Mem_.Assign(count, c);
-    if (needsTerminator)
-      Mem_.EmplaceBackUnsafe(Terminator);
+    check(count >= 0);
+    Grow(count);
+    Fill(Data(), count, c);
+    SetSize(count);
   }
 
   constexpr void Resize(i32 const newSize, CharT const c = Terminator)
   {
-    Mem_.Resize(newSize, c);
+    check(newSize >= 0);
+    i32 const currSize = Size();
+    if (newSize > currSize)
+    {
+      Grow(newSize);
+      Fill(Data() + currSize, newSize - currSize, c);
+    }
+    SetSize(newSize);
+  }
+
+  // Resizes to `newSize` characters plus the terminator, the new characters are left uninitialized.
+  // Meant to be followed by a write of the whole content (e.g. a formatting function or a file read).
+  constexpr void ResizeUninitialized(i32 const newSize)
+  {
+    check(newSize >= 0);
+    Grow(newSize);
+    SetSize(newSize);
   }
 
+  // Makes room for `newCapacity` characters, the terminator is accounted for.
   constexpr void Reserve(i32 const newCapacity)
   {
-    Mem_.Reserve(newCapacity);
+    Grow(newCapacity);
   }
 
+  // Keeps the capacity.
   constexpr void Clear()
   {
-    Mem_.Clear();
+    SetSize(0);
   }
 
   constexpr CharT* Insert(CharT const* pos, StringView<CharT> string)
   {
-    return Mem_.Insert(pos == end() ? pos - 1 : pos, string.begin(), string.end());
+    check(Data() <= pos && pos <= end());
+    if (Overlaps(string))
+    {
+      String const cpy(string, Allocator_);
+      return Insert(pos, cpy.AsView());
+    }
+
+    i32 const index    = i32(pos - Data());
+    i32 const currSize = Size();
+    i32 const count    = string.Size();
+    if (count == 0)
+      return Data() + index;
+
+    GrowForAppend(currSize + count);
+    CharT* const at = Data() + index;
+    std::memmove(at + count, at, (u64)(currSize - index) * sizeof(CharT));
+    std::memcpy(at, string.Data(), (u64)string.AllocSize());
+    SetSize(currSize + count);
+    return at;
   }
 
   constexpr CharT* Insert(i32 const pos, StringView<CharT> string)
@@ -404,13 +598,17 @@ public:
     return Erase(position, position + 1);
   }
 
-  constexpr CharT* Erase(CharT* begin, CharT* end)
+  constexpr CharT* Erase(CharT* first, CharT* last)
   {
-    check(Data() <= begin && end <= Data() + Size());
-    if (begin == end() || begin && *begin == Terminator)
-      return end();
+    CharT* const data     = Data();
+    i32 const    currSize = Size();
+    check(data <= first && first <= last && last <= data + currSize);
 
-    return Mem_.Erase(begin, end);
+    i32 const index = i32(first - data);
+    i32 const count = i32(last - first);
+    std::memmove(first, last, (u64)(currSize - index - count) * sizeof(CharT));
+    SetSize(currSize - count);
+    return Data() + index;
   }
 
   constexpr CharT* Erase(i32 const position)
@@ -430,7 +628,8 @@ public:
 
   constexpr void PopBack()
   {
-    Mem_.PopBack();
+    if (!IsEmpty())
+      SetSize(Size() - 1);
   }
 
   constexpr String operator+(StringView<CharT> other) const
@@ -463,7 +662,12 @@ public:
 
   u64 CalculateHash() const
   {
-    return AsView().CalculateHash();
+    // Empty strings point to the inline buffer, they hash as the null view they had before it
+    return IsEmpty() ? StringView<CharT>().CalculateHash() : AsView().CalculateHash();
   }
 };
+
+// The inline characters share the object with the heap storage, nothing points into the object
+template <typename CharT>
+inline constexpr bool IsTriviallyRelocatable<String<CharT>> = true;
 } // namespace Core
@@ -1,42 +1,102 @@
 #pragma once
 
 #include <Core/Algorithm/Algorithm.h>
+#include <Core/Algorithm/Relocate.h>
 #include <Core/Allocator/Allocator.h>
 #include <Core/Assert/Assert.h>
 #include <Core/Definitions.h>
 #include <Core/Iterator/ContiguousIterator.h>
-#include <cmath>
 #include <concepts>
 #include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 namespace Core
 {
-// Dynamic array
-template <typename T>
+// Growth policies: Grow returns the capacity to reallocate to when `capacity` can't hold `desiredSize` items.
+
+// Multiplies the capacity by Numerator / Denominator, amortized constant time insertions.
+template <i32 Numerator = 2, i32 Denominator = 1>
+struct GeometricGrowth
+{
+  static_assert(Numerator > Denominator && Denominator > 0, "GeometricGrowth factor shall be greater than 1.");
+
+  template <typename SizeT>
+  static constexpr SizeT Grow(SizeT capacity, SizeT const desiredSize)
+  {
+    if (capacity == 0)
+      return desiredSize;
+
+    constexpr u64 maxCapacity = (u64)std::numeric_limits<SizeT>::max();
+    while (capacity < desiredSize)
+    {
+      u64 const grown = (u64)capacity / Denominator * Numerator + (u64)capacity % Denominator * Numerator / Denominator;
+      capacity        = grown > maxCapacity ? SizeT(maxCapacity) : grown > (u64)capacity ? SizeT(grown) : capacity + 1;
+    }
+    return capacity;
+  }
+};
+
+// Rounds up to a multiple of Chunk items, bounding the slack of very large buffers at the cost of more copies.
+template <i64 Chunk>
+struct LinearGrowth
+{
+  static_assert(Chunk > 0, "LinearGrowth chunk shall be positive.");
+
+  template <typename SizeT>
+  static constexpr SizeT Grow(SizeT const, SizeT const desiredSize)
+  {
+    i64 const chunks = ((i64)desiredSize + Chunk - 1) / Chunk;
+    i64 const grown  = chunks * Chunk;
+    return grown > (i64)std::numeric_limits<SizeT>::max() ? desiredSize : SizeT(grown);
+  }
+};
+
+// Allocates exactly what's asked, for buffers sized once and rarely appended to.
+struct ExactGrowth
+{
+  template <typename SizeT>
+  static constexpr SizeT Grow(SizeT const, SizeT const desiredSize)
+  {
+    return desiredSize;
+  }
+};
+
+// Dynamic array.
+// `SizeT` is the signed type of sizes and indices, i64 lifts the 2 GB limit of the default i32 (see LargeVector).
+// `Growth` picks the capacity when appending past it, Reserve and ShrinkToFit allocate exactly.
+template <typename T, typename SizeT = i32, typename Growth = GeometricGrowth<>>
 class Vector
 {
-private:
-  inline static constexpr f32 ReallocRatio = 1.5f;
+  static_assert(std::is_same_v<SizeT, i32> || std::is_same_v<SizeT, i64>, "Vector size type shall be i32 or i64.");
 
+private:
   IAllocator* Allocator_;
   T*          Mem_;
-  i32         Size_;
-  i32         Capacity_;
+  SizeT       Size_;
+  SizeT       Capacity_;
 
   // Vector's state will now be 1:1 as a default constructed Vector, with the custom allocator.
   constexpr void Reset();
 
   // Reallocates the memory to the specified capacity, possibly without invalidating iterators.
-  constexpr void Realloc(i32 const newCapacity);
+  // `flags` applies only if a new block has to be allocated.
+  constexpr void Realloc(SizeT const newCapacity, AllocFlags const flags = AllocFlags::Uninitialized);
 
   // Invokes the destructor of all items in the provided range.
   constexpr static void Destroy(T* from, T* to);
 
-  // Calculates the new capacity given a size, based on the ReallocRatio.
-  constexpr static i32 CalculateCapacity(i32 const currCapacity, i32 const desiredSize);
+  // Moves the items from `pos` up by `count`, leaving [pos, pos + count) uninitialized. The capacity shall suffice.
+  constexpr void OpenGap(T* pos, SizeT const count);
+
+  // Moves the items from `gapEnd` down onto the uninitialized [gapBegin, gapEnd).
+  constexpr void CloseGap(T* gapBegin, T* gapEnd);
+
+  // Calculates the new capacity given a size, based on the growth policy.
+  constexpr static SizeT CalculateCapacity(SizeT const currCapacity, SizeT const desiredSize);
 
   template <typename U>
   static constexpr bool CanFastInitialize()
@@ -49,13 +109,13 @@ private:
 
 public:
   constexpr Vector(IAllocator* allocator = GetGlobalAllocator());
-  constexpr Vector(i32 const initialSize, IAllocator* allocator = GetGlobalAllocator());
+  constexpr Vector(SizeT const initialSize, IAllocator* allocator = GetGlobalAllocator());
 
   template <typename U = T>
   constexpr Vector(std::initializer_list<U> init, IAllocator* allocator = GetGlobalAllocator());
 
   template <typename U = T>
-  constexpr Vector(i32 const initialSize, U const& initialValue, IAllocator* allocator = GetGlobalAllocator());
+  constexpr Vector(SizeT const initialSize, U const& initialValue, IAllocator* allocator = GetGlobalAllocator());
 
   template <std::input_iterator Iterator>
   constexpr Vector(Iterator begin, Iterator end, IAllocator* allocator = GetGlobalAllocator());
@@ -73,13 +133,13 @@ public:
   constexpr IAllocator* Allocator() const;
 
   template <typename U = T>
-  constexpr void Assign(i32 const newSize, U const& newValue);
+  constexpr void Assign(SizeT const newSize, U const& newValue);
 
   template <std::input_iterator Iterator>
   constexpr void Assign(Iterator begin, Iterator end);
 
-  constexpr T&       operator[](i32 const pos);
-  constexpr T const& operator[](i32 const pos) const;
+  constexpr T&       operator[](SizeT const pos);
+  constexpr T const& operator[](SizeT const pos) const;
 
   constexpr T&       Front();
   constexpr T const& Front() const;
@@ -107,19 +167,26 @@ public:
 
   constexpr bool IsEmpty() const;
 
-  constexpr i32 Size() const;
+  constexpr SizeT Size() const;
+
+  constexpr SizeT Capacity() const;
 
-  constexpr i32 Capacity() const;
+  // The size of the items, in bytes.
+  constexpr i64 AllocSize() const;
 
-  // The allocated size, in bytes.
-  constexpr i32 AllocSize() const;
+  constexpr void Reserve(SizeT const capacity);
 
-  constexpr void Reserve(i32 const capacity);
+  // Reallocates to fit the size exactly, releasing the memory of an empty Vector.
+  constexpr void ShrinkToFit();
 
-  constexpr void Resize(i32 const newSize);
+  constexpr void Resize(SizeT const newSize);
 
   template <typename U = T>
-  constexpr void Resize(i32 const newSize, U const& value);
+  constexpr void Resize(SizeT const newSize, U const& value);
+
+  // Like Resize(newSize), but the new elements are left uninitialized.
+  // Meant for buffers that are filled right after, to avoid writing the memory twice.
+  constexpr void ResizeUninitialized(SizeT const newSize);
 
   constexpr void Swap(Vector& other);
 
@@ -129,16 +196,16 @@ public:
   constexpr T* Insert(T const* position, U&& value);
 
   template <typename U = T>
-  constexpr T* Insert(i32 const position, U&& value)
+  constexpr T* Insert(SizeT const position, U&& value)
   {
     return Insert(Data() + position, std::forward<U>(value));
   }
 
   template <typename U = T>
-  constexpr T* Insert(T const* position, i32 const count, U const& value);
+  constexpr T* Insert(T const* position, SizeT const count, U const& value);
 
   template <typename U = T>
-  constexpr T* Insert(i32 const position, i32 const count, U const& value)
+  constexpr T* Insert(SizeT const position, SizeT const count, U const& value)
   {
     return Insert(Data() + position, count, value);
   }
@@ -147,7 +214,7 @@ public:
   constexpr T* Insert(T const* position, Iterator begin, Iterator end);
 
   template <std::input_iterator Iterator>
-  constexpr T* Insert(i32 const position, Iterator begin, Iterator end)
+  constexpr T* Insert(SizeT const position, Iterator begin, Iterator end)
   {
     return Insert(Data() + position, begin, end);
   }
@@ -156,7 +223,7 @@ public:
   constexpr T* Emplace(T const* position, Args&&... args);
 
   template <typename... Args>
-  constexpr T* Emplace(i32 const position, Args&&... args)
+  constexpr T* Emplace(SizeT const position, Args&&... args)
   {
     return Emplace(Data() + position, std::forward<Args>(args)...);
   }
@@ -174,8 +241,8 @@ public:
 
   constexpr T* Erase(T* position);
   constexpr T* Erase(T* begin, T* end);
-  constexpr T* Erase(i32 const position);
-  constexpr T* Erase(i32 const position, i32 const count);
+  constexpr T* Erase(SizeT const position);
+  constexpr T* Erase(SizeT const position, SizeT const count);
 
   template <std::predicate<T const&> Comparer>
   constexpr T* EraseIf(Comparer&& comparer);
@@ -199,67 +266,60 @@ public:
   constexpr T const* Find(Comparer&& comparer) const;
 
   template <typename U = T>
-  constexpr bool operator==(Vector<U> const& other);
+  constexpr bool operator==(Vector<U, SizeT, Growth> const& other);
 
   template <typename U = T>
-  constexpr bool operator!=(Vector<U> const& other)
+  constexpr bool operator!=(Vector<U, SizeT, Growth> const& other)
   {
     return !operator==(other);
   }
 };
 
-template <typename T>
-constexpr inline void Vector<T>::Reset()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Reset()
 {
   Destroy(begin(), end());
-  Allocator_->Free(Mem_, alignof(T));
+  Allocator_->FreeSized(Mem_, Capacity_ * (i64)sizeof(T), alignof(T));
   Mem_  = nullptr;
   Size_ = Capacity_ = 0;
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Realloc(i32 const newCapacity)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Realloc(SizeT const newCapacity, AllocFlags const flags)
 {
   if (newCapacity == 0)
     return;
 
-  i32 const currSize = Size();
+  // Shrinking below the size drops the last items
+  if (newCapacity < Size_)
+  {
+    Destroy(Mem_ + newCapacity, end());
+    Size_ = newCapacity;
+  }
 
+  // Realloc only grows or shrinks in place, so the items don't move
   if (Mem_)
   {
-    if (T* newMem = (T*)Allocator_->Realloc(Mem_, newCapacity * (i64)sizeof(T), alignof(T)))
+    if (T* newMem = (T*)Allocator_->ReallocSized(Mem_, Capacity_ * (i64)sizeof(T), newCapacity * (i64)sizeof(T), alignof(T)))
     {
       Mem_      = newMem;
-      Size_     = currSize;
       Capacity_ = newCapacity;
       return;
     }
   }
 
-  T* newMem = (T*)Allocator_->Alloc(newCapacity * (i64)sizeof(T), alignof(T));
+  T* newMem = (T*)Allocator_->Alloc(newCapacity * (i64)sizeof(T), alignof(T), flags);
   checkf(newMem, "Couldn't allocate Vector memory.");
 
-  if constexpr (!std::is_trivially_default_constructible_v<T>)
-  {
-    for (T* item = newMem; item < newMem + currSize; ++item)
-      new (item) T();
-  }
-
-  if (newCapacity >= currSize)
-    Algorithm::Move(begin(), end(), newMem);
-  else
-    Algorithm::Move(begin(), end() - (currSize - newCapacity), newMem);
-
-  Destroy(begin(), end());
-  Allocator_->Free(Mem_, alignof(T));
+  Algorithm::Relocate(begin(), end(), newMem);
+  Allocator_->FreeSized(Mem_, Capacity_ * (i64)sizeof(T), alignof(T));
 
   Mem_      = newMem;
-  Size_     = currSize;
   Capacity_ = newCapacity;
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Destroy(T* from, T* to)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Destroy(T* from, T* to)
 {
   checkf(from <= to, "Vector Destroy called with invalid range.");
   if constexpr (!std::is_trivially_destructible_v<T>)
@@ -269,19 +329,61 @@ constexpr inline void Vector<T>::Destroy(T* from, T* to)
   }
 }
 
-template <typename T>
-constexpr inline i32 Vector<T>::CalculateCapacity(i32 currCapacity, i32 const desiredSize)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::OpenGap(T* pos, SizeT const count)
 {
-  if (currCapacity == 0)
-    return desiredSize;
+  T* const last = end();
+  if constexpr (IsTriviallyRelocatable<T>)
+  {
+    std::memmove((void*)(pos + count), (void const*)pos, u64(last - pos) * sizeof(T));
+  }
+  else
+  {
+    // Items landing past the end are constructed, the others are assigned onto items already moved up
+    for (T* from = last; from != pos;)
+    {
+      --from;
+      T* to = from + count;
+      if (to >= last)
+        new (to) T(std::move(*from));
+      else
+        *to = std::move(*from);
+    }
+    Destroy(pos, pos + count < last ? pos + count : last);
+  }
+}
 
-  while (currCapacity < desiredSize)
-    currCapacity *= (i32)std::ceilf(ReallocRatio);
-  return currCapacity;
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::CloseGap(T* gapBegin, T* gapEnd)
+{
+  T* const last = end();
+  if constexpr (IsTriviallyRelocatable<T>)
+  {
+    std::memmove((void*)gapBegin, (void const*)gapEnd, u64(last - gapEnd) * sizeof(T));
+  }
+  else
+  {
+    // Items landing in the gap are constructed, the others are assigned onto items already moved down
+    T* to = gapBegin;
+    for (T* from = gapEnd; from != last; ++from, ++to)
+    {
+      if (to < gapEnd)
+        new (to) T(std::move(*from));
+      else
+        *to = std::move(*from);
+    }
+    Destroy(to > gapEnd ? to : gapEnd, last);
+  }
 }
 
-template <typename T>
-constexpr inline Vector<T>::Vector(IAllocator* allocator)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline SizeT Vector<T, SizeT, Growth>::CalculateCapacity(SizeT const currCapacity, SizeT const desiredSize)
+{
+  return Growth::Grow(currCapacity, desiredSize);
+}
+
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::Vector(IAllocator* allocator)
     : Allocator_(allocator)
     , Mem_(nullptr)
     , Size_(0)
@@ -290,64 +392,66 @@ constexpr inline Vector<T>::Vector(IAllocator* allocator)
   checkf(allocator, "Invalid allocator!");
 }
 
-template <typename T>
-constexpr inline Vector<T>::Vector(i32 const initialSize, IAllocator* allocator)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::Vector(SizeT const initialSize, IAllocator* allocator)
     : Vector(allocator)
 {
   static_assert(std::default_initializable<T>, "T isn't default constructible.");
   if (initialSize)
   {
-    Realloc(initialSize);
-    Size_ = Capacity_;
     if constexpr (std::is_trivially_default_constructible_v<T>)
     {
-      std::memset(Mem_, 0, (u64)AllocSize());
+      // Zeroed by the allocator, which can often skip it (e.g. fresh pages from the OS)
+      Realloc(initialSize, AllocFlags::Zeroed);
+      Size_ = Capacity_;
     }
     else
     {
+      Realloc(initialSize);
+      Size_ = Capacity_;
       for (T* item = begin(); item < end(); ++item)
         new (item) T;
     }
   }
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline Vector<T>::Vector(std::initializer_list<U> init, IAllocator* allocator)
+constexpr inline Vector<T, SizeT, Growth>::Vector(std::initializer_list<U> init, IAllocator* allocator)
     : Vector(init.begin(), init.end(), allocator)
 {
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline Vector<T>::Vector(i32 const initialSize, U const& initialValue, IAllocator* allocator)
+constexpr inline Vector<T, SizeT, Growth>::Vector(SizeT const initialSize, U const& initialValue, IAllocator* allocator)
     : Vector(initialSize, allocator)
 {
   Assign(initialSize, initialValue);
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::input_iterator Iterator>
-constexpr inline Vector<T>::Vector(Iterator begin, Iterator end, IAllocator* allocator)
+constexpr inline Vector<T, SizeT, Growth>::Vector(Iterator begin, Iterator end, IAllocator* allocator)
     : Vector(allocator)
 {
   Assign(begin, end);
 }
 
-template <typename T>
-constexpr inline Vector<T>::Vector(Vector const& other)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::Vector(Vector const& other)
     : Vector(other, other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator())
 {
 }
 
-template <typename T>
-constexpr inline Vector<T>::Vector(Vector const& other, IAllocator* allocator)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::Vector(Vector const& other, IAllocator* allocator)
     : Vector(other.begin(), other.end(), allocator)
 {
 }
 
-template <typename T>
-constexpr inline Vector<T>::Vector(Vector&& other)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::Vector(Vector&& other)
     : Vector()
 {
   if (other.Allocator_->IsMovable())
@@ -367,25 +471,28 @@ constexpr inline Vector<T>::Vector(Vector&& other)
   }
 }
 
-template <typename T>
-constexpr inline Vector<T>::~Vector()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>::~Vector()
 {
   Reset();
   if (Allocator_->OwnedByContainer())
     delete Allocator_;
 }
 
-template <typename T>
-constexpr inline Vector<T>& Vector<T>::operator=(Vector const& other)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>& Vector<T, SizeT, Growth>::operator=(Vector const& other)
 {
+  if (this == &other)
+    return *this;
+
   Reset();
   Allocator_ = other.Allocator_->IsCopyable() ? other.Allocator_ : GetGlobalAllocator();
   Realloc(other.Capacity_);
-  Algorithm::Copy(other.begin(), other.end(), begin());
+  Assign(other.begin(), other.end());
   return *this;
 }
-template <typename T>
-constexpr inline Vector<T>& Vector<T>::operator=(Vector&& other)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline Vector<T, SizeT, Growth>& Vector<T, SizeT, Growth>::operator=(Vector&& other)
 {
   Reset();
   if (other.Allocator_->IsMovable())
@@ -405,20 +512,20 @@ constexpr inline Vector<T>& Vector<T>::operator=(Vector&& other)
   return *this;
 }
 
-template <typename T>
-constexpr inline IAllocator* Vector<T>::Allocator() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline IAllocator* Vector<T, SizeT, Growth>::Allocator() const
 {
   return Allocator_;
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline void Vector<T>::Assign(i32 const newSize, U const& newValue)
+constexpr inline void Vector<T, SizeT, Growth>::Assign(SizeT const newSize, U const& newValue)
 {
   static_assert(std::constructible_from<T, decltype(newValue)>, "Cannot construct Vector<T> from U const&.");
   Clear();
 
-  i32 const currCap = Capacity();
+  SizeT const currCap = Capacity();
   if (newSize > currCap)
     Realloc(CalculateCapacity(currCap, newSize));
 
@@ -435,15 +542,15 @@ constexpr inline void Vector<T>::Assign(i32 const newSize, U const& newValue)
   }
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::input_iterator Iterator>
-constexpr inline void Vector<T>::Assign(Iterator begin, Iterator end)
+constexpr inline void Vector<T, SizeT, Growth>::Assign(Iterator begin, Iterator end)
 {
   static_assert(std::constructible_from<T, decltype(*begin)>, "Cannot construct Vector<T> from the provided iterator.");
   Clear();
 
-  i32 const newSize = (i32)std::distance(begin, end);
-  i32 const currCap = Capacity();
+  SizeT const newSize = (SizeT)std::distance(begin, end);
+  SizeT const currCap = Capacity();
   if (newSize > currCap)
     Realloc(CalculateCapacity(currCap, newSize));
 
@@ -462,170 +569,182 @@ constexpr inline void Vector<T>::Assign(Iterator begin, Iterator end)
   }
 }
 
-template <typename T>
-constexpr inline T& Vector<T>::operator[](i32 const pos)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T& Vector<T, SizeT, Growth>::operator[](SizeT const pos)
 {
-  checkf(u32(pos) < u32(Size()), "Vector operator[] out-of-bounds access.");
+  checkf(std::make_unsigned_t<SizeT>(pos) < std::make_unsigned_t<SizeT>(Size_), "Vector operator[] out-of-bounds access.");
   return Mem_[pos];
 }
 
-template <typename T>
-constexpr inline T const& Vector<T>::operator[](i32 const pos) const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const& Vector<T, SizeT, Growth>::operator[](SizeT const pos) const
 {
-  checkf(u32(pos) < u32(Size()), "Vector operator[] out-of-bounds access.");
+  checkf(std::make_unsigned_t<SizeT>(pos) < std::make_unsigned_t<SizeT>(Size_), "Vector operator[] out-of-bounds access.");
   return Mem_[pos];
 }
 
-template <typename T>
-constexpr inline T& Vector<T>::Front()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T& Vector<T, SizeT, Growth>::Front()
 {
   checkf(!IsEmpty(), "Vector is empty, but Front() was called.");
   return Mem_[0];
 }
 
-template <typename T>
-constexpr inline T const& Vector<T>::Front() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const& Vector<T, SizeT, Growth>::Front() const
 {
   checkf(!IsEmpty(), "Vector is empty, but Front() was called.");
   return Mem_[0];
 }
 
-template <typename T>
-constexpr inline T& Vector<T>::Back()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T& Vector<T, SizeT, Growth>::Back()
 {
   checkf(!IsEmpty(), "Vector is empty, but Back() was called.");
   return *(end() - 1);
 }
 
-template <typename T>
-constexpr inline T const& Vector<T>::Back() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const& Vector<T, SizeT, Growth>::Back() const
 {
   checkf(!IsEmpty(), "Vector is empty, but Back() was called.");
   return *(end() - 1);
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::Data()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::Data()
 {
   return Mem_;
 }
 
-template <typename T>
-constexpr inline T const* Vector<T>::Data() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const* Vector<T, SizeT, Growth>::Data() const
 {
   return Mem_;
 }
 
-template <typename T>
-constexpr inline T** Vector<T>::PData()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T** Vector<T, SizeT, Growth>::PData()
 {
   return &Mem_;
 }
 
-template <typename T>
-constexpr inline T const** Vector<T>::PData() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const** Vector<T, SizeT, Growth>::PData() const
 {
   return &Mem_;
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::begin()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::begin()
 {
   return Mem_;
 }
 
-template <typename T>
-constexpr inline T const* Vector<T>::begin() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const* Vector<T, SizeT, Growth>::begin() const
 {
   return Mem_;
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::end()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::end()
 {
   return Mem_ + Size_;
 }
 
-template <typename T>
-constexpr inline T const* Vector<T>::end() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T const* Vector<T, SizeT, Growth>::end() const
 {
   return Mem_ + Size_;
 }
 
-template <typename T>
-inline constexpr ReverseContiguousIterator<T> Vector<T>::rbegin()
+template <typename T, typename SizeT, typename Growth>
+inline constexpr ReverseContiguousIterator<T> Vector<T, SizeT, Growth>::rbegin()
 {
   using It = ReverseContiguousIterator<T>;
   return IsEmpty() ? It(nullptr) : It(end() - 1);
 }
 
-template <typename T>
-inline constexpr ReverseContiguousIterator<T const> Vector<T>::rbegin() const
+template <typename T, typename SizeT, typename Growth>
+inline constexpr ReverseContiguousIterator<T const> Vector<T, SizeT, Growth>::rbegin() const
 {
   using It = ReverseContiguousIterator<T const>;
   return IsEmpty() ? It(nullptr) : It(end() - 1);
 }
-template <typename T>
-inline constexpr ReverseContiguousIterator<T> Vector<T>::rend()
+template <typename T, typename SizeT, typename Growth>
+inline constexpr ReverseContiguousIterator<T> Vector<T, SizeT, Growth>::rend()
 {
   using It = ReverseContiguousIterator<T>;
   return IsEmpty() ? It(nullptr) : It(begin() - 1);
 }
 
-template <typename T>
-inline constexpr ReverseContiguousIterator<T const> Vector<T>::rend() const
+template <typename T, typename SizeT, typename Growth>
+inline constexpr ReverseContiguousIterator<T const> Vector<T, SizeT, Growth>::rend() const
 {
   using It = ReverseContiguousIterator<T const>;
   return IsEmpty() ? It(nullptr) : It(begin() - 1);
 }
 
-template <typename T>
-constexpr inline bool Vector<T>::IsEmpty() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline bool Vector<T, SizeT, Growth>::IsEmpty() const
 {
   return Size_ == 0;
 }
 
-template <typename T>
-constexpr inline i32 Vector<T>::Size() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline SizeT Vector<T, SizeT, Growth>::Size() const
 {
   return Size_;
 }
 
-template <typename T>
-constexpr inline i32 Vector<T>::Capacity() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline SizeT Vector<T, SizeT, Growth>::Capacity() const
 {
   return Capacity_;
 }
 
-template <typename T>
-constexpr inline i32 Vector<T>::AllocSize() const
+template <typename T, typename SizeT, typename Growth>
+constexpr inline i64 Vector<T, SizeT, Growth>::AllocSize() const
 {
-  return Size() * (i32)sizeof(T);
+  return Size() * (i64)sizeof(T);
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Reserve(i32 const capacity)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Reserve(SizeT const capacity)
 {
-  i32 const currCap = Capacity();
+  SizeT const currCap = Capacity();
   if (currCap < capacity)
     Realloc(capacity);
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Resize(i32 const newSize)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::ShrinkToFit()
+{
+  if (Size_ == Capacity_)
+    return;
+
+  if (Size_ == 0)
+  {
+    Reset();
+    return;
+  }
+  Realloc(Size_);
+}
+
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Resize(SizeT const newSize)
 {
   static_assert(std::default_initializable<T>, "Vector Resize(newSize) requires T to be default constructible.");
 
-  i32 const currSize = Size();
-  i32 const currCap  = Capacity();
+  SizeT const currSize = Size();
+  SizeT const currCap  = Capacity();
   if (currCap < newSize)
     Realloc(newSize);
 
-  if (currSize == 0)
-    Size_ = newSize;
-
   if (currSize < newSize)
   {
+    Size_ = newSize;
     if constexpr (std::is_trivially_default_constructible_v<T>)
     {
       std::memset(begin() + currSize, 0, (end() - (Mem_ + currSize)) * sizeof(T));
@@ -638,20 +757,19 @@ constexpr inline void Vector<T>::Resize(i32 const newSize)
   }
   else if (currSize > newSize)
   {
-    i32 const ds = currSize - newSize;
-    Destroy(begin() + ds, end());
-    Size_ = ds;
+    Destroy(begin() + newSize, end());
+    Size_ = newSize;
   }
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline void Vector<T>::Resize(i32 const newSize, U const& value)
+constexpr inline void Vector<T, SizeT, Growth>::Resize(SizeT const newSize, U const& value)
 {
   static_assert(std::constructible_from<T, decltype(value)>, "Vector Resize(newSize, value) requires T to be constructible from value.");
 
-  i32 const currSize = Size();
-  i32 const currCap  = Capacity();
+  SizeT const currSize = Size();
+  SizeT const currCap  = Capacity();
 
   if (currSize < newSize)
   {
@@ -671,14 +789,26 @@ constexpr inline void Vector<T>::Resize(i32 const newSize, U const& value)
   }
   else if (currSize > newSize)
   {
-    i32 const ds = currSize - newSize;
-    Destroy(begin() + ds, end());
-    Size_ -= ds;
+    Destroy(begin() + newSize, end());
+    Size_ = newSize;
   }
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Swap(Vector& other)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::ResizeUninitialized(SizeT const newSize)
+{
+  static_assert(std::is_trivially_default_constructible_v<T>, "Vector ResizeUninitialized(newSize) requires T to be trivially default constructible.");
+
+  if (Capacity() < newSize)
+    Realloc(newSize);
+
+  if (Size() > newSize)
+    Destroy(begin() + newSize, end());
+  Size_ = newSize;
+}
+
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Swap(Vector& other)
 {
   if (verifyf(Allocator_->IsMovable() && other.Allocator_->IsMovable(), "Cannot swap Vector with immovable allocators, will fallback to a deep-copy without an allocator swap!"))
   {
@@ -695,23 +825,23 @@ constexpr inline void Vector<T>::Swap(Vector& other)
   }
 }
 
-template <typename T>
-constexpr inline void Vector<T>::Clear()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::Clear()
 {
   Destroy(begin(), end());
   Size_ = 0;
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline T* Vector<T>::Insert(T const* position, U&& value)
+constexpr inline T* Vector<T, SizeT, Growth>::Insert(T const* position, U&& value)
 {
   return Emplace(position, std::forward<U>(value));
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline T* Vector<T>::Insert(T const* position, i32 const count, U const& value)
+constexpr inline T* Vector<T, SizeT, Growth>::Insert(T const* position, SizeT const count, U const& value)
 {
   static_assert(std::constructible_from<T, decltype(value)>, "Vector Insert(position, count, value) cannot construct T from value.");
   checkf(begin() <= position && position <= end(), "Vector Insert(position, count, value) has an invalid position.");
@@ -721,17 +851,14 @@ constexpr inline T* Vector<T>::Insert(T const* position, i32 const count, U cons
     return begin();
   }
 
-  i32 const posIndex = i32(position - Mem_);
-  i32 const currCap  = Capacity();
-  i32 const currSize = Size();
-  i32 const newSize  = currSize + count;
+  SizeT const posIndex = SizeT(position - Mem_);
+  SizeT const currCap  = Capacity();
+  SizeT const currSize = Size();
+  SizeT const newSize  = currSize + count;
   if (currCap < newSize)
     Realloc(CalculateCapacity(currCap, newSize));
 
-  T* fromStart = Mem_ + posIndex;
-  T* fromEnd   = end();
-  T* to        = fromStart + count;
-  Algorithm::Move(fromStart, fromEnd, to);
+  OpenGap(Mem_ + posIndex, count);
   if constexpr (CanFastInitialize<U>())
   {
     std::memset(Mem_ + posIndex, (int)value, count * sizeof(T));
@@ -746,22 +873,22 @@ constexpr inline T* Vector<T>::Insert(T const* position, i32 const count, U cons
   return Mem_ + posIndex;
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::input_iterator Iterator>
-constexpr inline T* Vector<T>::Insert(T const* position, Iterator begin, Iterator end)
+constexpr inline T* Vector<T, SizeT, Growth>::Insert(T const* position, Iterator begin, Iterator end)
 {
   static_assert(std::constructible_from<T, decltype(*begin)>, "Vector Insert(position, begin, end) cannot construct T from *begin.");
   checkf(Mem_ <= position && position <= Mem_ + Size_, "Vector Insert(position, begin, end) has an invalid position.");
 
-  i32 const elemCount = (i32)std::distance(begin, end);
-  i32 const posIndex  = i32(position - Mem_);
-  i32 const currCap   = Capacity();
-  i32 const currSize  = Size();
-  i32 const newSize   = currSize + elemCount;
+  SizeT const elemCount = (SizeT)std::distance(begin, end);
+  SizeT const posIndex  = SizeT(position - Mem_);
+  SizeT const currCap   = Capacity();
+  SizeT const currSize  = Size();
+  SizeT const newSize   = currSize + elemCount;
   if (currCap < newSize)
     Realloc(CalculateCapacity(currCap, newSize));
 
-  Algorithm::Move(Mem_ + posIndex, Mem_ + Size_, Mem_ + posIndex + elemCount);
+  OpenGap(Mem_ + posIndex, elemCount);
 
   Size_ = newSize;
 
@@ -778,28 +905,28 @@ constexpr inline T* Vector<T>::Insert(T const* position, Iterator begin, Iterato
   return Mem_ + posIndex;
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename... Args>
-constexpr inline T* Vector<T>::Emplace(T const* position, Args&&... args)
+constexpr inline T* Vector<T, SizeT, Growth>::Emplace(T const* position, Args&&... args)
 {
   static_assert(std::constructible_from<T, Args...>, "Vector Emplace(position, Args...) cannot construct T from Args.");
   checkf(begin() <= position && position <= end(), "Vector Emplace(position, Args...) has an invalid position.");
-  i32 const posIndex = i32(position - Mem_);
-  i32 const size     = Size();
-  i32 const cap      = Capacity();
+  SizeT const posIndex = SizeT(position - Mem_);
+  SizeT const size     = Size();
+  SizeT const cap      = Capacity();
   if (size == cap)
     Realloc(CalculateCapacity(cap, size + 1));
 
   T* pos = Mem_ + posIndex;
-  Algorithm::Move(pos, end(), pos + 1);
+  OpenGap(pos, 1);
   new (pos) T(std::forward<Args>(args)...);
   ++Size_;
   return pos;
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename... Args>
-constexpr inline T* Vector<T>::EmplaceBackUnsafe(Args&&... args)
+constexpr inline T* Vector<T, SizeT, Growth>::EmplaceBackUnsafe(Args&&... args)
 {
   checkf(Size() < Capacity(), "Vector EmplaceBackUnsafe(Args) out of bounds insertion.");
   T* pos = Mem_ + Size_++;
@@ -807,8 +934,8 @@ constexpr inline T* Vector<T>::EmplaceBackUnsafe(Args&&... args)
   return pos;
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::Erase(T* position)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::Erase(T* position)
 {
   checkf(!position || begin() <= position && position <= end(), "Vector Erase(position) has an invalid position.");
   if (IsEmpty() || position == end())
@@ -816,45 +943,37 @@ constexpr inline T* Vector<T>::Erase(T* position)
   return Erase(position, position + 1);
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::Erase(T* begin, T* end)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::Erase(T* begin, T* end)
 {
   checkf(begin <= end && Mem_ <= begin && end <= Mem_ + Size_, "Vector Erase(begin, end) has an invalid range.");
   if (IsEmpty() || begin == end)
     return Mem_ + Size_;
 
-  if constexpr (!std::is_trivially_destructible_v<T>)
-  {
-    for (T* item = begin; item < end; ++item)
-    {
-      T&& tmp{std::move(*item)};
-      tmp.~T();
-    }
-  }
-  // It's safe to move as the range [begin, end) has moved-from objects
-  Algorithm::Move(end, Mem_ + Size_, begin);
-  Size_ -= i32(end - begin);
+  Destroy(begin, end);
+  CloseGap(begin, end);
+  Size_ -= SizeT(end - begin);
 
   if (Mem_ + Size_ <= end)
     return Mem_ + Size_;
   return end - 1;
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::Erase(i32 const position)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::Erase(SizeT const position)
 {
   return Erase(Mem_ + position);
 }
 
-template <typename T>
-constexpr inline T* Vector<T>::Erase(i32 const position, i32 const count)
+template <typename T, typename SizeT, typename Growth>
+constexpr inline T* Vector<T, SizeT, Growth>::Erase(SizeT const position, SizeT const count)
 {
   return Erase(Mem_ + position, Mem_ + position + count);
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::predicate<T const&> Comparer>
-constexpr T* Vector<T>::EraseIf(Comparer&& comparer)
+constexpr T* Vector<T, SizeT, Growth>::EraseIf(Comparer&& comparer)
 {
   T* curr = begin();
   while (curr != end())
@@ -862,38 +981,38 @@ constexpr T* Vector<T>::EraseIf(Comparer&& comparer)
   return curr;
 }
 
-template <typename T>
-constexpr inline void Vector<T>::PopBack()
+template <typename T, typename SizeT, typename Growth>
+constexpr inline void Vector<T, SizeT, Growth>::PopBack()
 {
   if (!IsEmpty())
     Mem_[--Size_].~T();
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline bool Vector<T>::Contains(U const& value) const
+constexpr inline bool Vector<T, SizeT, Growth>::Contains(U const& value) const
 {
   return Find(value) != end();
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::predicate<T const&> Comparer>
-constexpr inline bool Vector<T>::Contains(Comparer&& comparer) const
+constexpr inline bool Vector<T, SizeT, Growth>::Contains(Comparer&& comparer) const
 {
   return Find(std::forward<Comparer>(comparer)) != end();
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline T* Vector<T>::Find(U const& value)
+constexpr inline T* Vector<T, SizeT, Growth>::Find(U const& value)
 {
   auto const* selfConst = this;
   return const_cast<T*>(selfConst->Find(value));
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline T const* Vector<T>::Find(U const& value) const
+constexpr inline T const* Vector<T, SizeT, Growth>::Find(U const& value) const
 {
   static_assert(std::equality_comparable_with<decltype(*begin()), decltype(value)>, "Vector Find(value) cannot compare T == U");
   for (auto const& item : *this)
@@ -904,17 +1023,17 @@ constexpr inline T const* Vector<T>::Find(U const& value) const
   return end();
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::predicate<T const&> Comparer>
-constexpr inline T* Vector<T>::Find(Comparer&& comparer)
+constexpr inline T* Vector<T, SizeT, Growth>::Find(Comparer&& comparer)
 {
   auto const* selfConst = this;
   return const_cast<T*>(selfConst->Find(std::forward<Comparer>(comparer)));
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <std::predicate<T const&> Comparer>
-constexpr inline T const* Vector<T>::Find(Comparer&& comparer) const
+constexpr inline T const* Vector<T, SizeT, Growth>::Find(Comparer&& comparer) const
 {
   for (auto const& item : *this)
   {
@@ -924,9 +1043,9 @@ constexpr inline T const* Vector<T>::Find(Comparer&& comparer) const
   return end();
 }
 
-template <typename T>
+template <typename T, typename SizeT, typename Growth>
 template <typename U>
-constexpr inline bool Vector<T>::operator==(Vector<U> const& other)
+constexpr inline bool Vector<T, SizeT, Growth>::operator==(Vector<U, SizeT, Growth> const& other)
 {
   static_assert(std::equality_comparable_with<T const&, U const&>, "Vector operator==(Vector<U>) cannot compare T == U");
   if (Size() != other.Size())
@@ -938,7 +1057,7 @@ constexpr inline bool Vector<T>::operator==(Vector<U> const& other)
   }
   else
   {
-    for (i32 i = 0; i < Size(); ++i)
+    for (SizeT i = 0; i < Size(); ++i)
     {
 #pragma warning(suppress : 4'388) // '==': signed/unsigned mismatch
       if (!((*this)[i] == other[i]))
@@ -947,4 +1066,12 @@ constexpr inline bool Vector<T>::operator==(Vector<U> const& other)
     return true;
   }
 }
+
+// Vector with 64-bit sizes, for buffers that can exceed 2 GB or 2^31 items.
+template <typename T, typename Growth = GeometricGrowth<>>
+using LargeVector = Vector<T, i64, Growth>;
+
+// Only owns a heap block, the allocator isn't part of the object
+template <typename T, typename SizeT, typename Growth>
+inline constexpr bool IsTriviallyRelocatable<Vector<T, SizeT, Growth>> = true;
 } // namespace Core
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/Container/FlatMap.h>
+#include <Core/Container/InlineVector.h>
 #include <Core/Hash/Hash.h>
 #include <functional>
 
@@ -9,7 +10,7 @@ namespace Core
 template <typename... Args>
 class Delegate
 {
-  Core::CompactFlatMap<u64, std::function<void(Args...)>> Listeners_;
+  Core::CompactFlatMap<u64, std::function<void(Args...)>, Core::InlineStorage<2>::Type> Listeners_;
 
 public:
   constexpr Delegate()                           = default;
@@ -38,13 +39,13 @@ public:
   template <typename R>
   void RemoveListener(R (*Func)(Args...))
   {
-    Listeners_.TryErase(CalculateHash(Func));
+    Listeners_.TryRemove(CalculateHash(Func));
   }
 
   template <typename T, typename R>
   void RemoveListener(T* Instance, R (T::*Method)(Args...))
   {
-    Listeners_.TryErase(CalculateHash(Instance, Method));
+    Listeners_.TryRemove(CalculateHash(Instance, Method));
   }
 
   template <typename... UArgs>
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <Core/API.h>
+#include <Core/Concepts/Concepts.h>
 #include <Core/Definitions.h>
+#include <type_traits>
 
 namespace Core
 {
@@ -10,18 +12,52 @@ CORE_API u64 CalculateHash(void const* p, i32 const bytes);
 template <typename R, typename... Args>
 u64 CalculateHash(R (*Func)(Args...))
 {
-  return Func;
+  return CalculateHash(&Func, sizeof(Func));
 }
 
 template <typename T, typename R, typename... Args>
 u64 CalculateHash(T* Instance, R (T::*Method)(Args...))
 {
-#pragma pack(1)
+#pragma pack(push, 1)
   struct Dummy
   {
-    T*               Instance_ = Instance;
-    decltype(Method) Method_   = Method;
-  } Dummy_;
+    T*               Instance_;
+    decltype(Method) Method_;
+  } Dummy_{Instance, Method};
+#pragma pack(pop)
   return CalculateHash(&Dummy_, sizeof(Dummy_));
 }
+
+// Cheap bijective finalizer, spreads every bit of `x` over the whole result.
+constexpr u64 MixHash(u64 x)
+{
+  x ^= x >> 32;
+  x *= 0xD6E8'FEB8'6659'FD93ull;
+  x ^= x >> 32;
+  x *= 0xD6E8'FEB8'6659'FD93ull;
+  x ^= x >> 32;
+  return x;
+}
+
+// Hash function object used by the hashed containers.
+// Integers, enums and pointers are mixed inline, Hashable types are asked for their hash,
+// any other type is hashed from its object representation.
+template <typename T>
+struct Hasher
+{
+  u64 operator()(T const& value) const
+  {
+    if constexpr (Hashable<T>)
+      return MixHash(value.CalculateHash());
+    else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+      return MixHash(u64(value));
+    else if constexpr (std::is_pointer_v<T>)
+      return MixHash(u64(value));
+    else
+    {
+      static_assert(std::has_unique_object_representations_v<T>, "T has padding bits, provide a CalculateHash() member function.");
+      return CalculateHash(&value, sizeof(T));
+    }
+  }
+};
 } // namespace Core
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Core/API.h>
+#include <Core/Container/String.h>
+#include <Core/Definitions.h>
+
+namespace Core
+{
+// Handle to a string interned in the process-wide name table.
+// Names compare by index and carry the hash of their string, so neither needs to touch the characters.
+// Interning is thread-safe, and so are lookups of names already interned, which don't lock.
+// The order of operator< is the interning order, not the lexicographical one.
+class CORE_API Name
+{
+  u32 Index_;
+  u32 Hash_; // Low half of the XXH3 hash of the string
+
+  constexpr Name(u32 const index, u32 const hash)
+      : Index_(index)
+      , Hash_(hash)
+  {
+  }
+
+public:
+  // The None name, which is also what the empty string interns to.
+  constexpr Name()
+      : Index_(0)
+      , Hash_(0)
+  {
+  }
+
+  // Interns `string`, if needed, and returns its name.
+  explicit Name(StringView<char> string);
+
+  // Returns the name of `string` if it's already interned, None otherwise. Never inserts.
+  static Name Find(StringView<char> string);
+
+  // Number of names in the table, None included.
+  static i32 InternedCount();
+
+  constexpr bool IsNone() const
+  {
+    return Index_ == 0;
+  }
+
+  constexpr u32 Index() const
+  {
+    return Index_;
+  }
+
+  // Views the interned characters, which are null-terminated and live until the process exits.
+  StringView<char> AsView() const;
+  char const*      CStr() const;
+
+  constexpr u64 CalculateHash() const
+  {
+    return Hash_;
+  }
+
+  constexpr bool operator==(Name const other) const
+  {
+    return Index_ == other.Index_;
+  }
+
+  constexpr bool operator!=(Name const other) const
+  {
+    return Index_ != other.Index_;
+  }
+
+  constexpr bool operator<(Name const other) const
+  {
+    return Index_ < other.Index_;
+  }
+};
+static_assert(sizeof(Name) == sizeof(u64), "Name shall stay as small as a pointer.");
+} // namespace Core
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Core/API.h>
+#include <Core/Definitions.h>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#  define GE_CPU_X64 1
+#  include <immintrin.h>
+#endif
+
+// The build targets the baseline x64 instruction set, wider kernels are tagged with GE_TARGET and only called when
+// the CPU supports them. MSVC compiles the intrinsics of any instruction set, GCC and Clang need the tag.
+#if defined(_MSC_VER) && !defined(__clang__)
+#  define GE_TARGET(isa)
+#else
+#  define GE_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace Core
+{
+// Instruction sets the CPU supports and whose registers the OS saves on context switches.
+struct CpuFeatures
+{
+  bool Avx2_;
+  bool Avx512_;
+};
+
+// Detected on first use.
+CORE_API CpuFeatures const& GetCpuFeatures();
+
+// For the kernels of header templates, which dispatch on every call: the answer is cached in the calling module.
+inline bool HasAvx2()
+{
+#if defined(__AVX2__)
+  return true;
+#else
+  static bool const hasAvx2 = GetCpuFeatures().Avx2_;
+  return hasAvx2;
+#endif
+}
+} // namespace Core
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Core/API.h>
+#include <Core/Definitions.h>
+
+namespace Core::VirtualMemory
+{
+// Granularity of Commit/Decommit, in bytes.
+CORE_API i64 PageSize();
+
+// Reserves a range of address space without backing it with physical memory.
+// Returns nullptr on failure.
+CORE_API void* Reserve(i64 const size);
+
+// Backs [p, p + size) with zeroed, read-write memory. `p` and `size` shall be multiple of PageSize().
+CORE_API bool Commit(void* p, i64 const size);
+
+// Gives back the physical memory of [p, p + size), the range stays reserved.
+CORE_API void Decommit(void* p, i64 const size);
+
+// Releases a range obtained by Reserve().
+CORE_API void Release(void* p, i64 const size);
+} // namespace Core::VirtualMemory
@@ -0,0 +1,244 @@
+#include <Core/Algorithm/Memory.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Platform/Cpu.h>
+#include <cstdlib>
+#include <cstring>
+
+namespace Core::Algorithm
+{
+using Private::LargeMemoryKernels;
+
+static void CopyCrt(u8* to, u8 const* from, i64 const size)
+{
+  std::memcpy(to, from, (size_t)size);
+}
+
+static void FillCrt(u8* to, u8 const value, i64 const size)
+{
+  std::memset(to, value, (size_t)size);
+}
+
+#if GE_CPU_X64
+// The kernels write the bytes up to the first aligned destination with the CRT, stream whole vectors, then write
+// the tail with the CRT. The streamed stores are fenced before returning, so the other threads see them in order.
+// Copies move a cache line of 4 consecutive pages at a time, interleaving the streams is ~20% faster than a single
+// one past the caches.
+
+static constexpr i64 StreamPageSize  = 4096;
+static constexpr i64 StreamPageCount = 4;
+static constexpr i64 StreamBlockSize = StreamPageSize * StreamPageCount;
+
+static i64 HeadSize(u8 const* to, i64 const alignment)
+{
+  return (alignment - i64((u64)to & u64(alignment - 1))) & (alignment - 1);
+}
+
+static void CopyStreamSse2(u8* to, u8 const* from, i64 size)
+{
+  i64 const head = HeadSize(to, 16);
+  std::memcpy(to, from, (size_t)head);
+  to += head, from += head, size -= head;
+  for (; size >= StreamBlockSize; to += StreamBlockSize, from += StreamBlockSize, size -= StreamBlockSize)
+  {
+    for (i64 line = 0; line < StreamPageSize; line += 64)
+    {
+      for (i64 page = 0; page < StreamBlockSize; page += StreamPageSize)
+      {
+        u8 const* const src = from + page + line;
+        u8* const       dst = to + page + line;
+        __m128i const   a   = _mm_loadu_si128((__m128i const*)src);
+        __m128i const   b   = _mm_loadu_si128((__m128i const*)(src + 16));
+        __m128i const   c   = _mm_loadu_si128((__m128i const*)(src + 32));
+        __m128i const   d   = _mm_loadu_si128((__m128i const*)(src + 48));
+        _mm_stream_si128((__m128i*)dst, a);
+        _mm_stream_si128((__m128i*)(dst + 16), b);
+        _mm_stream_si128((__m128i*)(dst + 32), c);
+        _mm_stream_si128((__m128i*)(dst + 48), d);
+      }
+    }
+  }
+  _mm_sfence();
+  std::memcpy(to, from, (size_t)size);
+}
+
+static void FillStreamSse2(u8* to, u8 const value, i64 size)
+{
+  i64 const head = HeadSize(to, 16);
+  std::memset(to, value, (size_t)head);
+  to += head, size -= head;
+  __m128i const x = _mm_set1_epi8((char)value);
+  for (; size >= 64; to += 64, size -= 64)
+  {
+    _mm_stream_si128((__m128i*)to, x);
+    _mm_stream_si128((__m128i*)(to + 16), x);
+    _mm_stream_si128((__m128i*)(to + 32), x);
+    _mm_stream_si128((__m128i*)(to + 48), x);
+  }
+  _mm_sfence();
+  std::memset(to, value, (size_t)size);
+}
+
+GE_TARGET("avx2") static void CopyStreamAvx2(u8* to, u8 const* from, i64 size)
+{
+  i64 const head = HeadSize(to, 32);
+  std::memcpy(to, from, (size_t)head);
+  to += head, from += head, size -= head;
+  for (; size >= StreamBlockSize; to += StreamBlockSize, from += StreamBlockSize, size -= StreamBlockSize)
+  {
+    for (i64 line = 0; line < StreamPageSize; line += 64)
+    {
+      for (i64 page = 0; page < StreamBlockSize; page += StreamPageSize)
+      {
+        u8 const* const src = from + page + line;
+        u8* const       dst = to + page + line;
+        __m256i const   a   = _mm256_loadu_si256((__m256i const*)src);
+        __m256i const   b   = _mm256_loadu_si256((__m256i const*)(src + 32));
+        _mm256_stream_si256((__m256i*)dst, a);
+        _mm256_stream_si256((__m256i*)(dst + 32), b);
+      }
+    }
+  }
+  _mm_sfence();
+  _mm256_zeroupper();
+  std::memcpy(to, from, (size_t)size);
+}
+
+GE_TARGET("avx2") static void FillStreamAvx2(u8* to, u8 const value, i64 size)
+{
+  i64 const head = HeadSize(to, 32);
+  std::memset(to, value, (size_t)head);
+  to += head, size -= head;
+  __m256i const x = _mm256_set1_epi8((char)value);
+  for (; size >= 128; to += 128, size -= 128)
+  {
+    _mm256_stream_si256((__m256i*)to, x);
+    _mm256_stream_si256((__m256i*)(to + 32), x);
+    _mm256_stream_si256((__m256i*)(to + 64), x);
+    _mm256_stream_si256((__m256i*)(to + 96), x);
+  }
+  _mm_sfence();
+  _mm256_zeroupper();
+  std::memset(to, value, (size_t)size);
+}
+
+GE_TARGET("avx512f") static void CopyStreamAvx512(u8* to, u8 const* from, i64 size)
+{
+  i64 const head = HeadSize(to, 64);
+  std::memcpy(to, from, (size_t)head);
+  to += head, from += head, size -= head;
+  for (; size >= StreamBlockSize; to += StreamBlockSize, from += StreamBlockSize, size -= StreamBlockSize)
+  {
+    for (i64 line = 0; line < StreamPageSize; line += 64)
+    {
+      for (i64 page = 0; page < StreamBlockSize; page += StreamPageSize)
+        _mm512_stream_si512((__m512i*)(to + page + line), _mm512_loadu_si512(from + page + line));
+    }
+  }
+  _mm_sfence();
+  _mm256_zeroupper();
+  std::memcpy(to, from, (size_t)size);
+}
+
+GE_TARGET("avx512f") static void FillStreamAvx512(u8* to, u8 const value, i64 size)
+{
+  i64 const head = HeadSize(to, 64);
+  std::memset(to, value, (size_t)head);
+  to += head, size -= head;
+  __m512i const x = _mm512_set1_epi32(i32(0x0101'0101u * value));
+  for (; size >= 256; to += 256, size -= 256)
+  {
+    _mm512_stream_si512((__m512i*)to, x);
+    _mm512_stream_si512((__m512i*)(to + 64), x);
+    _mm512_stream_si512((__m512i*)(to + 128), x);
+    _mm512_stream_si512((__m512i*)(to + 192), x);
+  }
+  _mm_sfence();
+  _mm256_zeroupper();
+  std::memset(to, value, (size_t)size);
+}
+#endif
+
+static constexpr LargeMemoryKernels KernelsCrt{"CRT", &CopyCrt, &FillCrt};
+#if GE_CPU_X64
+static constexpr LargeMemoryKernels KernelsSse2{"SSE2", &CopyStreamSse2, &FillStreamSse2};
+static constexpr LargeMemoryKernels KernelsAvx2{"AVX2", &CopyStreamAvx2, &FillStreamAvx2};
+static constexpr LargeMemoryKernels KernelsAvx512{"AVX-512", &CopyStreamAvx512, &FillStreamAvx512};
+#endif
+
+// Fastest first, the CRT one always last
+struct SupportedKernels
+{
+  LargeMemoryKernels Kernels_[4];
+  i32                Count_;
+};
+
+static SupportedKernels DetectKernels()
+{
+  SupportedKernels supported{};
+#if GE_CPU_X64
+  CpuFeatures const& features = GetCpuFeatures();
+  if (features.Avx512_)
+    supported.Kernels_[supported.Count_++] = KernelsAvx512;
+  if (features.Avx2_)
+    supported.Kernels_[supported.Count_++] = KernelsAvx2;
+  supported.Kernels_[supported.Count_++] = KernelsSse2;
+#endif
+  supported.Kernels_[supported.Count_++] = KernelsCrt;
+  return supported;
+}
+
+namespace Private
+{
+Span<LargeMemoryKernels const> SupportedLargeMemoryKernels()
+{
+  static SupportedKernels const supported = DetectKernels();
+  return {supported.Kernels_, supported.Count_};
+}
+} // namespace Private
+
+static LargeMemoryKernels SelectKernels()
+{
+  Span<LargeMemoryKernels const> const supported = Private::SupportedLargeMemoryKernels();
+  if (char const* name = std::getenv("GE_LARGE_MEMORY_KERNEL"))
+  {
+    for (LargeMemoryKernels const& kernels : supported)
+    {
+      if (std::strcmp(name, kernels.Name_) == 0)
+        return kernels;
+    }
+  }
+  return supported[0];
+}
+
+static LargeMemoryKernels const& GetKernels()
+{
+  static LargeMemoryKernels const kernels = SelectKernels();
+  return kernels;
+}
+
+void CopyLarge(void* to, void const* from, i64 const size)
+{
+  checkf(size >= 0, "CopyLarge size shall be positive.");
+  u64 const  toAddr   = (u64)to;
+  u64 const  fromAddr = (u64)from;
+  bool const overlap  = toAddr < fromAddr + (u64)size && fromAddr < toAddr + (u64)size;
+  if (size < NonTemporalThreshold || overlap)
+    std::memmove(to, from, (size_t)size);
+  else
+    GetKernels().Copy_((u8*)to, (u8 const*)from, size);
+}
+
+void FillLarge(void* to, u8 const value, i64 const size)
+{
+  checkf(size >= 0, "FillLarge size shall be positive.");
+  if (size < NonTemporalThreshold)
+    std::memset(to, value, (size_t)size);
+  else
+    GetKernels().Fill_((u8*)to, value, size);
+}
+
+void ZeroLarge(void* to, i64 const size)
+{
+  FillLarge(to, 0, size);
+}
+} // namespace Core::Algorithm
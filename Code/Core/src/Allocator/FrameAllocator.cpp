@@ -0,0 +1,198 @@
+#include <Core/Allocator/FrameAllocator.h>
+#include <Core/Assert/Assert.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Core
+{
+struct FrameAllocator::Block
+{
+  Block* Next_;
+  i64    Capacity_;
+
+  u8* Begin()
+  {
+    return (u8*)(this + 1);
+  }
+
+  u8* End()
+  {
+    return Begin() + Capacity_;
+  }
+};
+
+static u8* AlignUp(u8* p, i32 const alignment)
+{
+  u64 const mask = u64(alignment) - 1;
+  return (u8*)((u64(p) + mask) & ~mask);
+}
+
+FrameAllocator* GetFrameAllocator()
+{
+  static FrameAllocator instance;
+  return &instance;
+}
+
+FrameAllocator::FrameAllocator(i64 const blockSize, IAllocator* parent)
+    : Parent_(parent)
+    , BlockSize_(blockSize)
+    , Active_(0)
+    , HighWaterMark_(0)
+    , OverflowCount_(0)
+{
+  checkf(parent, "Invalid parent allocator!");
+  checkf(blockSize > 0, "Block size must be positive.");
+}
+
+FrameAllocator::~FrameAllocator()
+{
+  ReleaseBuffer(Buffers_[0]);
+  ReleaseBuffer(Buffers_[1]);
+}
+
+void FrameAllocator::BeginFrame()
+{
+  Active_ ^= 1;
+  ResetBuffer(Buffers_[Active_]);
+}
+
+FrameAllocator::Stats FrameAllocator::GetStats() const
+{
+  Buffer const& buffer = Buffers_[Active_];
+
+  i32 blockCount = 0;
+  for (Block const* block = buffer.First_; block; block = block->Next_)
+    ++blockCount;
+
+  return {
+      .UsedBytes_     = buffer.Used_,
+      .HighWaterMark_ = HighWaterMark_,
+      .BlockCount_    = blockCount,
+      .OverflowCount_ = OverflowCount_,
+  };
+}
+
+__declspec(allocator) __declspec(restrict) void* FrameAllocator::Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  Buffer& buffer = Buffers_[Active_];
+
+  u8* p = AlignUp(buffer.Cursor_, alignment);
+  if (!buffer.Current_ || p + size > buffer.Current_->End())
+  {
+    Block* block = AllocBlock(std::max(BlockSize_, size + alignment));
+    if (!block)
+      return nullptr;
+
+    if (buffer.Current_)
+    {
+      buffer.Current_->Next_ = block;
+      ++OverflowCount_;
+    }
+    else
+    {
+      buffer.First_ = block;
+    }
+    buffer.Current_ = block;
+    buffer.Cursor_  = block->Begin();
+    p               = AlignUp(buffer.Cursor_, alignment);
+  }
+
+  buffer.Used_   += (p + size) - buffer.Cursor_;
+  buffer.Top_     = p;
+  buffer.Cursor_  = p + size;
+  HighWaterMark_  = std::max(HighWaterMark_, buffer.Used_);
+  if (flags == AllocFlags::Zeroed)
+    std::memset(p, 0, (u64)size);
+  return p;
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* FrameAllocator::Realloc(void* p, i64 const size, i32 const alignment)
+{
+  (void)alignment;
+  Buffer& buffer = Buffers_[Active_];
+
+  // Only the last allocation can be resized, as it's the only one with nothing after it
+  if (!p || p != buffer.Top_ || buffer.Top_ + size > buffer.Current_->End())
+    return nullptr;
+
+  buffer.Used_   += (buffer.Top_ + size) - buffer.Cursor_;
+  buffer.Cursor_  = buffer.Top_ + size;
+  HighWaterMark_  = std::max(HighWaterMark_, buffer.Used_);
+  return p;
+}
+
+__declspec(noalias) void FrameAllocator::Free(void* p, i32 const alignment)
+{
+  (void)alignment;
+  Buffer& buffer = Buffers_[Active_];
+
+  // Rewinding the last allocation makes push/pop patterns free, anything else is released by BeginFrame()
+  if (p && p == buffer.Top_)
+  {
+    buffer.Used_   -= buffer.Cursor_ - buffer.Top_;
+    buffer.Cursor_  = buffer.Top_;
+    buffer.Top_     = nullptr;
+  }
+}
+
+bool FrameAllocator::IsMovable()
+{
+  return true;
+}
+
+bool FrameAllocator::IsCopyable()
+{
+  return true;
+}
+
+bool FrameAllocator::OwnedByContainer()
+{
+  return false;
+}
+
+FrameAllocator::Block* FrameAllocator::AllocBlock(i64 const capacity)
+{
+  static_assert(sizeof(Block) % 16 == 0, "Block header must keep the payload 16-bytes aligned.");
+  auto* block = (Block*)Parent_->Alloc((i64)sizeof(Block) + capacity, alignof(Block));
+  checkf(block, "Couldn't allocate FrameAllocator block of %lld bytes.", capacity);
+  if (block)
+  {
+    block->Next_     = nullptr;
+    block->Capacity_ = capacity;
+  }
+  return block;
+}
+
+void FrameAllocator::ResetBuffer(Buffer& buffer)
+{
+  // A chain means last time this buffer overflowed, we collapse it into a single block sized for the peak usage,
+  // plus one block of headroom as the alignment padding might be different when everything is contiguous
+  if (buffer.First_ && buffer.First_->Next_)
+  {
+    ReleaseBuffer(buffer);
+    buffer.First_ = buffer.Current_ = AllocBlock(HighWaterMark_ + BlockSize_);
+  }
+  else
+  {
+    buffer.Current_ = buffer.First_;
+  }
+
+  buffer.Cursor_ = buffer.First_ ? buffer.First_->Begin() : nullptr;
+  buffer.Top_    = nullptr;
+  buffer.Used_   = 0;
+}
+
+void FrameAllocator::ReleaseBuffer(Buffer& buffer)
+{
+  Block* block = buffer.First_;
+  while (block)
+  {
+    Block* next = block->Next_;
+    Parent_->Free(block, alignof(Block));
+    block = next;
+  }
+  buffer = {};
+}
+} // namespace Core
@@ -1,9 +1,13 @@
 #include <Core/Allocator/GlobalAllocator.h>
+#include <Core/Allocator/TrackingAllocator.h>
 #include <Core/Assert/Assert.h>
-#include <Windows.h>
 #include <bit>
+#include <cstdlib>
+#include <cstring>
 #include <new>
 
+#include "GlobalAllocatorBackends.h"
+
 namespace Core
 {
 IAllocator* GetGlobalAllocator()
@@ -11,65 +15,158 @@ IAllocator* GetGlobalAllocator()
   return &GlobalAllocator::GetInstance();
 }
 
-static HANDLE MemHandle = GetProcessHeap() ? GetProcessHeap() : HeapCreate(0, 0, 0);
-
-constexpr static void* ToAlignedPointer(void* p, u64 const alignment)
+static GlobalAllocatorBackend SelectBackend()
 {
-  u64 addr  = (u64)p;
-  addr     += sizeof(void*) + alignment - 1;
-  addr     &= ~(alignment - 1);
-  return (void*)addr;
+  if (char const* name = std::getenv("GE_GLOBAL_ALLOCATOR"))
+  {
+    for (i32 i = 0; i < (i32)GlobalAllocatorBackend::Count; ++i)
+    {
+      auto const backend = (GlobalAllocatorBackend)i;
+      if (GlobalAllocator::IsBackendAvailable(backend) && std::strcmp(name, GlobalAllocator::GetBackendName(backend)) == 0)
+        return backend;
+    }
+  }
+
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  return GlobalAllocatorBackend::Rpmalloc;
+#elif defined(_WIN32)
+  return GlobalAllocatorBackend::Heap;
+#else
+  return GlobalAllocatorBackend::Malloc;
+#endif
 }
 
-constexpr static void* FromAlignedPointer(void* p, i32 const alignment)
+GlobalAllocator::GlobalAllocator(GlobalAllocatorBackend const backend)
+    : Backend_(backend)
 {
-  return alignment <= MEMORY_ALLOCATION_ALIGNMENT ? p : ((void**)p)[-1];
+  checkf(IsBackendAvailable(backend), "GlobalAllocator backend %s isn't available in this build.", GetBackendName(backend));
 }
 
 GlobalAllocator& GlobalAllocator::GetInstance()
 {
-  static GlobalAllocator instance;
+  static GlobalAllocator instance(SelectBackend());
   return instance;
 }
-__declspec(allocator) __declspec(restrict) void* GlobalAllocator::Alloc(i64 size, i32 const alignment)
+
+bool GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend const backend)
 {
-  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
-  if (alignment <= MEMORY_ALLOCATION_ALIGNMENT)
-    return HeapAlloc(MemHandle, HEAP_ZERO_MEMORY, (u64)size);
+  switch (backend)
+  {
+#ifdef _WIN32
+  case GlobalAllocatorBackend::Heap:
+    return true;
+#endif
+  case GlobalAllocatorBackend::Malloc:
+    return true;
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  case GlobalAllocatorBackend::Rpmalloc:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
 
-  i32 const   offset    = (i32)(sizeof(void*) + (alignment - 1));
-  void* const allocated = HeapAlloc(MemHandle, HEAP_ZERO_MEMORY, (u64)(size + offset));
-  if (!allocated)
-    return nullptr;
+char const* GlobalAllocator::GetBackendName(GlobalAllocatorBackend const backend)
+{
+  switch (backend)
+  {
+  case GlobalAllocatorBackend::Heap:
+    return "heap";
+  case GlobalAllocatorBackend::Malloc:
+    return "malloc";
+  case GlobalAllocatorBackend::Rpmalloc:
+    return "rpmalloc";
+  default:
+    return "invalid";
+  }
+}
+
+void GlobalAllocator::ThreadInitialize()
+{
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  if (GetInstance().Backend_ == GlobalAllocatorBackend::Rpmalloc)
+    RpmallocBackend::ThreadInitialize();
+#endif
+}
+
+void GlobalAllocator::ThreadFinalize()
+{
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  // Done even if rpmalloc isn't the global backend, as another instance may have initialized the thread
+  RpmallocBackend::ThreadFinalize();
+#endif
+}
+
+GlobalAllocatorBackend GlobalAllocator::GetBackend() const
+{
+  return Backend_;
+}
 
-  void* aligned         = ToAlignedPointer(allocated, (u64)alignment);
-  ((void**)aligned)[-1] = allocated;
-  return aligned;
+__declspec(allocator) __declspec(restrict) void* GlobalAllocator::Alloc(i64 size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  switch (Backend_)
+  {
+#ifdef _WIN32
+  case GlobalAllocatorBackend::Heap:
+    return HeapBackend::Alloc(size, alignment, flags);
+#endif
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  case GlobalAllocatorBackend::Rpmalloc:
+    return RpmallocBackend::Alloc(size, alignment, flags);
+#endif
+  default:
+    return MallocBackend::Alloc(size, alignment, flags);
+  }
 }
 
 __declspec(allocator) __declspec(restrict) __declspec(noalias) void* GlobalAllocator::Realloc(void* toRealloc, i64 size, i32 const alignment)
 {
-  checkf((alignment == 1 || !(alignment & 0x1)), "Alignment must be a power of 2.");
-  if (alignment <= MEMORY_ALLOCATION_ALIGNMENT)
-    return HeapReAlloc(MemHandle, HEAP_REALLOC_IN_PLACE_ONLY | HEAP_ZERO_MEMORY, toRealloc, (u64)size);
+  return ReallocSized(toRealloc, 0, size, alignment);
+}
 
-  void*     actualPtr   = FromAlignedPointer(toRealloc, alignment);
-  i32 const offset      = i32(sizeof(void*) + (alignment - 1));
-  void*     reallocated = HeapReAlloc(MemHandle, HEAP_REALLOC_IN_PLACE_ONLY | HEAP_ZERO_MEMORY, actualPtr, u64(size + offset));
-  if (!reallocated)
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* GlobalAllocator::ReallocSized(void* toRealloc, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  if (!toRealloc)
     return nullptr;
 
-  void* aligned         = ToAlignedPointer(reallocated, (u64)alignment);
-  ((void**)aligned)[-1] = reallocated;
-  return aligned;
+  switch (Backend_)
+  {
+#ifdef _WIN32
+  case GlobalAllocatorBackend::Heap:
+    return HeapBackend::Realloc(toRealloc, oldSize, size, alignment);
+#endif
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  case GlobalAllocatorBackend::Rpmalloc:
+    return RpmallocBackend::Realloc(toRealloc, oldSize, size, alignment);
+#endif
+  default:
+    return MallocBackend::Realloc(toRealloc, oldSize, size, alignment);
+  }
 }
 
 __declspec(noalias) void GlobalAllocator::Free(void* p, i32 const alignment)
 {
-  if (p)
+  if (!p)
+    return;
+
+  switch (Backend_)
   {
-    void* actual = FromAlignedPointer(p, alignment);
-    HeapFree(MemHandle, 0, actual);
+#ifdef _WIN32
+  case GlobalAllocatorBackend::Heap:
+    HeapBackend::Free(p, alignment);
+    break;
+#endif
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+  case GlobalAllocatorBackend::Rpmalloc:
+    RpmallocBackend::Free(p, alignment);
+    break;
+#endif
+  default:
+    MallocBackend::Free(p, alignment);
+    break;
   }
 }
 
@@ -90,89 +187,101 @@ bool GlobalAllocator::OwnedByContainer()
 } // namespace Core
 
 #pragma warning(disable : 28'251)
+static constexpr i32 DefaultNewAlignment = (i32)__STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// Allocations made via new/delete are attributed to the thread's current memory tag when tracking is enabled
+static Core::IAllocator* GetNewDeleteAllocator()
+{
+#if GE_MEMORY_TRACKING_ENABLED
+  return Core::GetTrackingAllocator();
+#else
+  return Core::GetGlobalAllocator();
+#endif
+}
+
 // operator new
 
 void* operator new(std::size_t count)
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, MEMORY_ALLOCATION_ALIGNMENT);
+  return GetNewDeleteAllocator()->Alloc((i64)count, DefaultNewAlignment);
 }
 void* operator new[](std::size_t count)
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, MEMORY_ALLOCATION_ALIGNMENT);
+  return GetNewDeleteAllocator()->Alloc((i64)count, DefaultNewAlignment);
 }
 void* operator new(std::size_t count, std::align_val_t al)
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, (i32)al);
+  return GetNewDeleteAllocator()->Alloc((i64)count, (i32)al);
 }
 void* operator new[](std::size_t count, std::align_val_t al)
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, (i32)al);
+  return GetNewDeleteAllocator()->Alloc((i64)count, (i32)al);
 }
 void* operator new(std::size_t count, std::nothrow_t const&) noexcept
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, MEMORY_ALLOCATION_ALIGNMENT);
+  return GetNewDeleteAllocator()->Alloc((i64)count, DefaultNewAlignment);
 }
 void* operator new[](std::size_t count, std::nothrow_t const&) noexcept
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, MEMORY_ALLOCATION_ALIGNMENT);
+  return GetNewDeleteAllocator()->Alloc((i64)count, DefaultNewAlignment);
 }
 void* operator new(std::size_t count, std::align_val_t al, std::nothrow_t const&) noexcept
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, (i32)al);
+  return GetNewDeleteAllocator()->Alloc((i64)count, (i32)al);
 }
 void* operator new[](std::size_t count, std::align_val_t al, std::nothrow_t const&) noexcept
 {
-  return Core::GetGlobalAllocator()->Alloc((i64)count, (i32)al);
+  return GetNewDeleteAllocator()->Alloc((i64)count, (i32)al);
 }
 
 // operator delete
 
 void operator delete(void* ptr) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->Free(ptr, DefaultNewAlignment);
 }
 void operator delete[](void* ptr) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->Free(ptr, DefaultNewAlignment);
 }
 void operator delete(void* ptr, std::align_val_t al) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->Free(ptr, (i32)al);
 }
 void operator delete[](void* ptr, std::align_val_t al) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->Free(ptr, (i32)al);
 }
-void operator delete(void* ptr, std::size_t) noexcept
+void operator delete(void* ptr, std::size_t size) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->FreeSized(ptr, (i64)size, DefaultNewAlignment);
 }
-void operator delete[](void* ptr, std::size_t) noexcept
+void operator delete[](void* ptr, std::size_t size) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->FreeSized(ptr, (i64)size, DefaultNewAlignment);
 }
-void operator delete(void* ptr, std::size_t, std::align_val_t al) noexcept
+void operator delete(void* ptr, std::size_t size, std::align_val_t al) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->FreeSized(ptr, (i64)size, (i32)al);
 }
-void operator delete[](void* ptr, std::size_t, std::align_val_t al) noexcept
+void operator delete[](void* ptr, std::size_t size, std::align_val_t al) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->FreeSized(ptr, (i64)size, (i32)al);
 }
 void operator delete(void* ptr, std::nothrow_t const&) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->Free(ptr, DefaultNewAlignment);
 }
 void operator delete[](void* ptr, std::nothrow_t const&) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, MEMORY_ALLOCATION_ALIGNMENT);
+  GetNewDeleteAllocator()->Free(ptr, DefaultNewAlignment);
 }
 void operator delete(void* ptr, std::align_val_t al, std::nothrow_t const&) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->Free(ptr, (i32)al);
 }
 void operator delete[](void* ptr, std::align_val_t al, std::nothrow_t const&) noexcept
 {
-  Core::GetGlobalAllocator()->Free(ptr, (i32)al);
+  GetNewDeleteAllocator()->Free(ptr, (i32)al);
 }
 #pragma warning(default : 28'251)
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Core/Allocator/Allocator.h>
+
+// Implementations of the GlobalAllocator backends, one translation unit each.
+// Realloc never moves the block, `oldSize` is 0 when unknown.
+namespace Core
+{
+#ifdef _WIN32
+namespace HeapBackend
+{
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags);
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment);
+void  Free(void* p, i32 const alignment);
+} // namespace HeapBackend
+#endif
+
+namespace MallocBackend
+{
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags);
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment);
+void  Free(void* p, i32 const alignment);
+} // namespace MallocBackend
+
+#if GE_ALLOCATOR_RPMALLOC_ENABLED
+namespace RpmallocBackend
+{
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags);
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment);
+void  Free(void* p, i32 const alignment);
+
+void ThreadInitialize();
+void ThreadFinalize();
+} // namespace RpmallocBackend
+#endif
+} // namespace Core
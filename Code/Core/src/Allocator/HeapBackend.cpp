@@ -0,0 +1,59 @@
+#include <Windows.h>
+
+#include "GlobalAllocatorBackends.h"
+
+namespace Core::HeapBackend
+{
+static HANDLE MemHandle = GetProcessHeap() ? GetProcessHeap() : HeapCreate(0, 0, 0);
+
+constexpr static void* ToAlignedPointer(void* p, u64 const alignment)
+{
+  u64 addr  = (u64)p;
+  addr     += sizeof(void*) + alignment - 1;
+  addr     &= ~(alignment - 1);
+  return (void*)addr;
+}
+
+constexpr static void* FromAlignedPointer(void* p, i32 const alignment)
+{
+  return alignment <= MEMORY_ALLOCATION_ALIGNMENT ? p : ((void**)p)[-1];
+}
+
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  DWORD const heapFlags = flags == AllocFlags::Zeroed ? HEAP_ZERO_MEMORY : 0;
+  if (alignment <= MEMORY_ALLOCATION_ALIGNMENT)
+    return HeapAlloc(MemHandle, heapFlags, (u64)size);
+
+  i32 const   offset    = (i32)(sizeof(void*) + (alignment - 1));
+  void* const allocated = HeapAlloc(MemHandle, heapFlags, (u64)(size + offset));
+  if (!allocated)
+    return nullptr;
+
+  void* aligned         = ToAlignedPointer(allocated, (u64)alignment);
+  ((void**)aligned)[-1] = allocated;
+  return aligned;
+}
+
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  (void)oldSize;
+  if (alignment <= MEMORY_ALLOCATION_ALIGNMENT)
+    return HeapReAlloc(MemHandle, HEAP_REALLOC_IN_PLACE_ONLY, p, (u64)size);
+
+  void*     actualPtr   = FromAlignedPointer(p, alignment);
+  i32 const offset      = i32(sizeof(void*) + (alignment - 1));
+  void*     reallocated = HeapReAlloc(MemHandle, HEAP_REALLOC_IN_PLACE_ONLY, actualPtr, u64(size + offset));
+  if (!reallocated)
+    return nullptr;
+
+  void* aligned         = ToAlignedPointer(reallocated, (u64)alignment);
+  ((void**)aligned)[-1] = reallocated;
+  return aligned;
+}
+
+void Free(void* p, i32 const alignment)
+{
+  HeapFree(MemHandle, 0, FromAlignedPointer(p, alignment));
+}
+} // namespace Core::HeapBackend
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+
+#include "GlobalAllocatorBackends.h"
+
+namespace Core::MallocBackend
+{
+// Every block of malloc is aligned at least to this
+constexpr i32 DefaultAlignment = alignof(std::max_align_t);
+
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  // malloc(0) may return nullptr, which would be taken as a failure
+  u64 const bytes = (u64)std::max(size, i64(1));
+#ifdef _WIN32
+  void* p = _aligned_malloc(bytes, (u64)alignment);
+  if (p && flags == AllocFlags::Zeroed)
+    std::memset(p, 0, bytes);
+  return p;
+#else
+  if (alignment <= DefaultAlignment)
+    return flags == AllocFlags::Zeroed ? std::calloc(1, bytes) : std::malloc(bytes);
+
+  // aligned_alloc requires the size to be a multiple of the alignment
+  u64 const alignedBytes = (bytes + u64(alignment) - 1) & ~(u64(alignment) - 1);
+  void*     p            = std::aligned_alloc((u64)alignment, alignedBytes);
+  if (p && flags == AllocFlags::Zeroed)
+    std::memset(p, 0, alignedBytes);
+  return p;
+#endif
+}
+
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  (void)oldSize;
+  // The CRT can't grow a block in-place, but the block may already be big enough
+#ifdef _WIN32
+  return _aligned_msize(p, (u64)alignment, 0) >= (u64)size ? p : nullptr;
+#else
+  (void)alignment;
+  return malloc_usable_size(p) >= (u64)size ? p : nullptr;
+#endif
+}
+
+void Free(void* p, i32 const alignment)
+{
+  (void)alignment;
+#ifdef _WIN32
+  _aligned_free(p);
+#else
+  std::free(p);
+#endif
+}
+} // namespace Core::MallocBackend
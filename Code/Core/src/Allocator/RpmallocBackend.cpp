@@ -0,0 +1,78 @@
+#include <Core/Assert/Assert.h>
+
+// rpmalloc is vendored by Tracy, in namespace tracy and compiled only if TRACY_ENABLE.
+#ifndef TRACY_ENABLE
+#  define TRACY_ENABLE
+#endif
+
+// This copy is private to Core. When the Tracy DLL is linked in (GE_PROFILING_ENABLED without TRACY_STATIC), its
+// TRACY_IMPORTS interface definition would declare the functions defined here dllimport (C2491). TracyApi.h is
+// included first so its include guard keeps the empty TRACY_API below.
+#undef TRACY_IMPORTS
+#undef TRACY_EXPORTS
+#include <common/TracyApi.h>
+#undef TRACY_API
+#define TRACY_API
+
+// Tracy's own rpmalloc, in namespace tracy, is also linked in with the profiler. The token macro renames this copy
+// to keep the two apart, and only spans the include: it would rename any other `tracy` identifier.
+#define tracy ge_rpmalloc
+#pragma warning(push, 0)
+#include <client/tracy_rpmalloc.cpp>
+#pragma warning(pop)
+#undef tracy
+
+namespace ge_rpmalloc
+{
+// Defined by TracyProfiler.cpp in Tracy's copy, set when a thread releases its heap
+thread_local bool RpThreadShutdown = false;
+} // namespace ge_rpmalloc
+
+#include "GlobalAllocatorBackends.h"
+
+namespace Core::RpmallocBackend
+{
+// rpmalloc blocks are always aligned to this, bigger alignments go through the rpaligned_* functions
+constexpr i32 DefaultAlignment = 16;
+
+// Threads which didn't call ThreadInitialize() (e.g. spawned by a 3rd-party library) get a heap on their first allocation
+static void EnsureThreadInitialized()
+{
+  if (!ge_rpmalloc::rpmalloc_is_thread_initialized()) [[unlikely]]
+    ge_rpmalloc::rpmalloc_initialize();
+}
+
+void* Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(alignment < 64 * 1'024, "rpmalloc can't align to the span size or more.");
+  EnsureThreadInitialized();
+  if (alignment <= DefaultAlignment)
+    return flags == AllocFlags::Zeroed ? ge_rpmalloc::rpcalloc(1, (size_t)size) : ge_rpmalloc::rpmalloc((size_t)size);
+  return flags == AllocFlags::Zeroed ? ge_rpmalloc::rpaligned_calloc((size_t)alignment, 1, (size_t)size) : ge_rpmalloc::rpaligned_alloc((size_t)alignment, (size_t)size);
+}
+
+void* Realloc(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  EnsureThreadInitialized();
+  u32 const flags = RPMALLOC_GROW_OR_FAIL;
+  return ge_rpmalloc::rpaligned_realloc(p, alignment <= DefaultAlignment ? 0 : (size_t)alignment, (size_t)size, (size_t)oldSize, flags);
+}
+
+void Free(void* p, i32 const alignment)
+{
+  (void)alignment;
+  ge_rpmalloc::rpfree(p);
+}
+
+void ThreadInitialize()
+{
+  // Initializes the global state too, if it's the first thread
+  ge_rpmalloc::rpmalloc_initialize();
+}
+
+void ThreadFinalize()
+{
+  if (ge_rpmalloc::rpmalloc_is_thread_initialized())
+    ge_rpmalloc::rpmalloc_thread_finalize(1);
+}
+} // namespace Core::RpmallocBackend
@@ -0,0 +1,152 @@
+#include <Core/Allocator/StackAllocator.h>
+#include <Core/Assert/Assert.h>
+#include <bit>
+#include <cstring>
+
+namespace Core
+{
+static u8* AlignUp(u8* p, i32 const alignment)
+{
+  u64 const mask = u64(alignment) - 1;
+  return (u8*)((u64(p) + mask) & ~mask);
+}
+
+StackAllocator::StackAllocator(i64 const capacity, IAllocator* parent)
+    : StackAllocator(parent ? parent->Alloc(capacity, 16) : nullptr, capacity, parent)
+{
+  OwnsBuffer_ = true;
+}
+
+StackAllocator::StackAllocator(void* buffer, i64 const capacity, IAllocator* parent)
+    : Parent_(parent)
+    , Begin_((u8*)buffer)
+    , End_((u8*)buffer + capacity)
+    , Cursor_((u8*)buffer)
+    , Last_(nullptr)
+    , OwnsBuffer_(false)
+{
+  checkf(parent, "Invalid parent allocator!");
+  checkf(buffer && capacity > 0, "Invalid StackAllocator buffer.");
+}
+
+StackAllocator::~StackAllocator()
+{
+  if (OwnsBuffer_)
+    Parent_->Free(Begin_, 16);
+}
+
+StackAllocator::Marker StackAllocator::GetMarker() const
+{
+  return {Cursor_, Last_};
+}
+
+void StackAllocator::Rewind(Marker const marker)
+{
+  checkf(Begin_ <= marker.Cursor_ && marker.Cursor_ <= End_, "StackAllocator Rewind called with a marker of another allocator.");
+  Cursor_ = marker.Cursor_;
+  Last_   = marker.Last_;
+}
+
+void StackAllocator::Reset()
+{
+  Cursor_ = Begin_;
+  Last_   = nullptr;
+}
+
+i64 StackAllocator::Used() const
+{
+  return Cursor_ - Begin_;
+}
+
+i64 StackAllocator::Capacity() const
+{
+  return End_ - Begin_;
+}
+
+bool StackAllocator::Owns(void const* p) const
+{
+  return Begin_ <= (u8 const*)p && (u8 const*)p < End_;
+}
+
+__declspec(allocator) __declspec(restrict) void* StackAllocator::Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  // An empty block of a full buffer would point one past its end, which Owns() can't tell from a parent's block
+  if (size == 0)
+    return nullptr;
+
+  u8* p = AlignUp(Cursor_, alignment);
+  if (p + size > End_)
+    return Parent_->Alloc(size, alignment, flags);
+
+  Last_   = p;
+  Cursor_ = p + size;
+  if (flags == AllocFlags::Zeroed)
+    std::memset(p, 0, (u64)size);
+  return p;
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* StackAllocator::Realloc(void* p, i64 const size, i32 const alignment)
+{
+  if (!p)
+    return nullptr;
+
+  if (!Owns(p))
+    return Parent_->Realloc(p, size, alignment);
+
+  if (p != Last_ || Last_ + size > End_)
+    return nullptr;
+
+  Cursor_ = Last_ + size;
+  return p;
+}
+
+__declspec(noalias) void StackAllocator::Free(void* p, i32 const alignment)
+{
+  if (!p)
+    return;
+
+  if (!Owns(p))
+  {
+    Parent_->Free(p, alignment);
+    return;
+  }
+
+  // Only the last allocation can be popped, anything below it is released by Rewind()
+  if (p == Last_)
+  {
+    Cursor_ = Last_;
+    Last_   = nullptr;
+  }
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* StackAllocator::ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  if (p && !Owns(p))
+    return Parent_->ReallocSized(p, oldSize, size, alignment);
+  return Realloc(p, size, alignment);
+}
+
+__declspec(noalias) void StackAllocator::FreeSized(void* p, i64 const size, i32 const alignment)
+{
+  if (p && !Owns(p))
+    Parent_->FreeSized(p, size, alignment);
+  else
+    Free(p, alignment);
+}
+
+bool StackAllocator::IsMovable()
+{
+  return true;
+}
+
+bool StackAllocator::IsCopyable()
+{
+  return true;
+}
+
+bool StackAllocator::OwnedByContainer()
+{
+  return false;
+}
+} // namespace Core
@@ -0,0 +1,236 @@
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Assert/Assert.h>
+#include <algorithm>
+#include <bit>
+
+#if GE_PROFILING_ENABLED
+#  include <tracy/Tracy.hpp>
+#endif
+
+namespace Core
+{
+namespace
+{
+struct Header
+{
+  i64       Size_;
+  MemoryTag Tag_;
+};
+static_assert(sizeof(Header) <= 16, "The header shall fit in the minimum offset.");
+
+// Distance between the block returned by the inner allocator and the user pointer, a multiple of the alignment
+i32 HeaderOffset(i32 const alignment)
+{
+  return std::max(alignment, 16);
+}
+
+Header* GetHeader(void* p)
+{
+  return (Header*)p - 1;
+}
+
+void UpdatePeak(std::atomic<i64>& peak, i64 const live)
+{
+  i64 current = peak.load(std::memory_order_relaxed);
+  while (current < live && !peak.compare_exchange_weak(current, live, std::memory_order_relaxed))
+    ;
+}
+
+thread_local MemoryTag CurrentTag = MemoryTag::Untagged;
+} // namespace
+
+char const* GetMemoryTagName(MemoryTag const tag)
+{
+  switch (tag)
+  {
+  case MemoryTag::Untagged:
+    return "Untagged";
+  case MemoryTag::Core:
+    return "Core";
+  case MemoryTag::Engine:
+    return "Engine";
+  case MemoryTag::ECS:
+    return "ECS";
+  case MemoryTag::Renderer:
+    return "Renderer";
+  case MemoryTag::Physics:
+    return "Physics";
+  case MemoryTag::Input:
+    return "Input";
+  case MemoryTag::Logging:
+    return "Logging";
+  case MemoryTag::Reflection:
+    return "Reflection";
+  default:
+    return "Invalid";
+  }
+}
+
+MemoryTag GetCurrentMemoryTag()
+{
+  return CurrentTag;
+}
+
+void SetCurrentMemoryTag(MemoryTag const tag)
+{
+  checkf(tag < MemoryTag::Count, "Invalid memory tag.");
+  CurrentTag = tag;
+}
+
+TrackingAllocator* GetTrackingAllocator()
+{
+  static TrackingAllocator instance;
+  return &instance;
+}
+
+TrackingAllocator::TrackingAllocator(IAllocator* inner, MemoryTag const tag)
+    : Inner_(inner)
+    , Tag_(tag)
+{
+  checkf(inner, "Invalid inner allocator!");
+  checkf(tag < MemoryTag::Count, "Invalid memory tag.");
+}
+
+TrackingAllocator::Stats TrackingAllocator::GetStats(MemoryTag const tag) const
+{
+  Counters const& counters = Counters_[(i32)tag];
+
+  Stats stats;
+  stats.LiveBytes_  = counters.LiveBytes_.load(std::memory_order_relaxed);
+  stats.PeakBytes_  = counters.PeakBytes_.load(std::memory_order_relaxed);
+  stats.LiveCount_  = counters.LiveCount_.load(std::memory_order_relaxed);
+  stats.AllocCount_ = counters.AllocCount_.load(std::memory_order_relaxed);
+  for (i32 i = 0; i < HistogramBuckets; ++i)
+    stats.Histogram_[i] = counters.Histogram_[i].load(std::memory_order_relaxed);
+  return stats;
+}
+
+TrackingAllocator::Stats TrackingAllocator::GetTotalStats() const
+{
+  // Sum of the per-tag peaks, tags may not have peaked at the same time
+  Stats total;
+  for (i32 tag = 0; tag < (i32)MemoryTag::Count; ++tag)
+  {
+    Stats const stats  = GetStats((MemoryTag)tag);
+    total.LiveBytes_  += stats.LiveBytes_;
+    total.PeakBytes_  += stats.PeakBytes_;
+    total.LiveCount_  += stats.LiveCount_;
+    total.AllocCount_ += stats.AllocCount_;
+    for (i32 i = 0; i < HistogramBuckets; ++i)
+      total.Histogram_[i] += stats.Histogram_[i];
+  }
+  return total;
+}
+
+i32 TrackingAllocator::GetHistogramBucket(i64 const size)
+{
+  // 16 bytes and less go to bucket 0, then one bucket per power of 2
+  i32 const bucket = (i32)std::bit_width(u64(std::max(size, i64(1)) - 1)) - 4;
+  return std::clamp(bucket, 0, HistogramBuckets - 1);
+}
+
+__declspec(allocator) __declspec(restrict) void* TrackingAllocator::Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  i32 const offset = HeaderOffset(alignment);
+  u8* const block  = (u8*)Inner_->Alloc(size + offset, offset, flags);
+  if (!block)
+    return nullptr;
+
+  MemoryTag const tag = Tag_ != MemoryTag::Untagged ? Tag_ : CurrentTag;
+  void* const     p   = block + offset;
+  *GetHeader(p)       = {size, tag};
+  OnAlloc(tag, size);
+
+#if GE_PROFILING_ENABLED
+  TracyAllocN(p, size, GetMemoryTagName(tag));
+#endif
+  return p;
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* TrackingAllocator::Realloc(void* p, i64 const size, i32 const alignment)
+{
+  if (!p)
+    return nullptr;
+
+  i32 const    offset = HeaderOffset(alignment);
+  Header const header = *GetHeader(p);
+  if (!Inner_->ReallocSized((u8*)p - offset, header.Size_ + offset, size + offset, offset))
+    return nullptr;
+
+  GetHeader(p)->Size_ = size;
+  OnResize(header.Tag_, header.Size_, size);
+
+#if GE_PROFILING_ENABLED
+  TracyFreeN(p, GetMemoryTagName(header.Tag_));
+  TracyAllocN(p, size, GetMemoryTagName(header.Tag_));
+#endif
+  return p;
+}
+
+__declspec(noalias) void TrackingAllocator::Free(void* p, i32 const alignment)
+{
+  if (!p)
+    return;
+
+  Header const header = *GetHeader(p);
+  OnFree(header.Tag_, header.Size_);
+
+#if GE_PROFILING_ENABLED
+  TracyFreeN(p, GetMemoryTagName(header.Tag_));
+#endif
+
+  i32 const offset = HeaderOffset(alignment);
+  Inner_->FreeSized((u8*)p - offset, header.Size_ + offset, offset);
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* TrackingAllocator::ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+{
+  checkf(!p || GetHeader(p)->Size_ == oldSize, "TrackingAllocator ReallocSized called with a wrong size.");
+  return Realloc(p, size, alignment);
+}
+
+__declspec(noalias) void TrackingAllocator::FreeSized(void* p, i64 const size, i32 const alignment)
+{
+  checkf(!p || GetHeader(p)->Size_ == size, "TrackingAllocator FreeSized called with a wrong size.");
+  Free(p, alignment);
+}
+
+bool TrackingAllocator::IsMovable()
+{
+  return Inner_->IsMovable();
+}
+
+bool TrackingAllocator::IsCopyable()
+{
+  return Inner_->IsCopyable();
+}
+
+bool TrackingAllocator::OwnedByContainer()
+{
+  return false;
+}
+
+void TrackingAllocator::OnAlloc(MemoryTag const tag, i64 const size)
+{
+  Counters& counters = Counters_[(i32)tag];
+  UpdatePeak(counters.PeakBytes_, counters.LiveBytes_.fetch_add(size, std::memory_order_relaxed) + size);
+  counters.LiveCount_.fetch_add(1, std::memory_order_relaxed);
+  counters.AllocCount_.fetch_add(1, std::memory_order_relaxed);
+  counters.Histogram_[GetHistogramBucket(size)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void TrackingAllocator::OnResize(MemoryTag const tag, i64 const oldSize, i64 const newSize)
+{
+  Counters& counters = Counters_[(i32)tag];
+  i64 const delta    = newSize - oldSize;
+  UpdatePeak(counters.PeakBytes_, counters.LiveBytes_.fetch_add(delta, std::memory_order_relaxed) + delta);
+}
+
+void TrackingAllocator::OnFree(MemoryTag const tag, i64 const size)
+{
+  Counters& counters = Counters_[(i32)tag];
+  counters.LiveBytes_.fetch_sub(size, std::memory_order_relaxed);
+  counters.LiveCount_.fetch_sub(1, std::memory_order_relaxed);
+}
+} // namespace Core
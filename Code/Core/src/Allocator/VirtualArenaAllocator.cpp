@@ -0,0 +1,136 @@
+#include <Core/Allocator/VirtualArenaAllocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Platform/VirtualMemory.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Core
+{
+static u8* AlignUp(u8* p, i64 const alignment)
+{
+  u64 const mask = u64(alignment) - 1;
+  return (u8*)((u64(p) + mask) & ~mask);
+}
+
+VirtualArenaAllocator::VirtualArenaAllocator(i64 const reserveSize)
+{
+  i64 const granularity = std::max(CommitGranularity, VirtualMemory::PageSize());
+  i64 const size        = (reserveSize + granularity - 1) / granularity * granularity;
+
+  Begin_ = Cursor_ = CommitEnd_ = (u8*)VirtualMemory::Reserve(size);
+  checkf(Begin_, "Couldn't reserve %lld bytes of address space.", size);
+  ReserveEnd_ = Begin_ ? Begin_ + size : nullptr;
+  Last_       = nullptr;
+}
+
+VirtualArenaAllocator::~VirtualArenaAllocator()
+{
+  if (Begin_)
+    VirtualMemory::Release(Begin_, ReserveEnd_ - Begin_);
+}
+
+void VirtualArenaAllocator::Reset()
+{
+  Cursor_ = Begin_;
+  Last_   = nullptr;
+  Trim();
+}
+
+i64 VirtualArenaAllocator::Used() const
+{
+  return Cursor_ - Begin_;
+}
+
+i64 VirtualArenaAllocator::Committed() const
+{
+  return CommitEnd_ - Begin_;
+}
+
+i64 VirtualArenaAllocator::Reserved() const
+{
+  return ReserveEnd_ - Begin_;
+}
+
+__declspec(allocator) __declspec(restrict) void* VirtualArenaAllocator::Alloc(i64 const size, i32 const alignment, AllocFlags const flags)
+{
+  checkf(std::has_single_bit((u32)alignment), "Alignment must be a power of 2.");
+  u8* p = AlignUp(Cursor_, alignment);
+  if (!EnsureCommitted(p + size))
+    return nullptr;
+
+  Last_   = p;
+  Cursor_ = p + size;
+  if (flags == AllocFlags::Zeroed)
+    std::memset(p, 0, (u64)size);
+  return p;
+}
+
+__declspec(allocator) __declspec(restrict) __declspec(noalias) void* VirtualArenaAllocator::Realloc(void* p, i64 const size, i32 const alignment)
+{
+  (void)alignment;
+  if (!p || p != Last_ || !EnsureCommitted(Last_ + size))
+    return nullptr;
+
+  bool const shrinks = Last_ + size < Cursor_;
+  Cursor_            = Last_ + size;
+  if (shrinks)
+    Trim();
+  return p;
+}
+
+__declspec(noalias) void VirtualArenaAllocator::Free(void* p, i32 const alignment)
+{
+  (void)alignment;
+  if (p && p == Last_)
+  {
+    Cursor_ = Last_;
+    Last_   = nullptr;
+    Trim();
+  }
+}
+
+bool VirtualArenaAllocator::IsMovable()
+{
+  return true;
+}
+
+bool VirtualArenaAllocator::IsCopyable()
+{
+  // A copy would be placed after the original, which then couldn't grow in-place anymore
+  return false;
+}
+
+bool VirtualArenaAllocator::OwnedByContainer()
+{
+  return false;
+}
+
+bool VirtualArenaAllocator::EnsureCommitted(u8* end)
+{
+  if (end <= CommitEnd_)
+    return true;
+
+  if (end > ReserveEnd_)
+    return false;
+
+  i64 const granularity = std::max(CommitGranularity, VirtualMemory::PageSize());
+  u8* const newEnd      = std::min(AlignUp(end, granularity), ReserveEnd_);
+  if (!VirtualMemory::Commit(CommitEnd_, newEnd - CommitEnd_))
+    return false;
+
+  CommitEnd_ = newEnd;
+  return true;
+}
+
+void VirtualArenaAllocator::Trim()
+{
+  i64 const granularity = std::max(CommitGranularity, VirtualMemory::PageSize());
+  u8* const keepEnd     = AlignUp(Cursor_, granularity);
+  if (keepEnd < CommitEnd_)
+  {
+    VirtualMemory::Decommit(keepEnd, CommitEnd_ - keepEnd);
+    CommitEnd_ = keepEnd;
+  }
+}
+} // namespace Core
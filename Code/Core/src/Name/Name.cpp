@@ -0,0 +1,253 @@
+#include <Core/Allocator/Allocator.h>
+#include <Core/Assert/Assert.h>
+#include <Core/Hash/Hash.h>
+#include <Core/Name/Name.h>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace Core
+{
+namespace
+{
+struct NameEntry
+{
+  char const* Chars_; // Null-terminated, never moves
+  i32         Size_;
+  u32         Hash_;
+};
+
+// Entries live in fixed chunks which are never reallocated, so readers can hold on to them without locking
+constexpr i32 ChunkEntriesLog2 = 12;
+constexpr i32 ChunkEntries     = 1 << ChunkEntriesLog2;
+constexpr i32 MaxChunks        = 1024;
+
+// Characters are bump-allocated from pages, longer names get a page of their own
+constexpr i64 CharsPageSize = 64 * 1024;
+
+// Open addressing lookup index, each slot packs the hash in the high half and the entry index + 1 in the low one.
+// A grown index replaces the previous one, which is kept alive for the readers still probing it.
+struct NameIndex
+{
+  NameIndex*        Previous_;
+  u64               Mask_;
+  std::atomic<u64>* Slots_;
+};
+
+class NameTable
+{
+  std::atomic<NameEntry*> Chunks_[MaxChunks]{};
+  std::atomic<i32>        Count_{0};
+  std::atomic<NameIndex*> Index_{nullptr};
+
+  // Only writers lock
+  std::mutex WriteMutex_;
+  void*      CharsPage_{}; // Starts with the pointer to the previous page
+  i64        CharsPageUsed_{CharsPageSize};
+
+  char const* StoreChars(StringView<char> const string)
+  {
+    i64 const bytes = string.Size() + 1;
+    char*     dest;
+    if (bytes > CharsPageSize - (i64)sizeof(void*))
+    {
+      // Oversized names get a dedicated page, linked behind the current one
+      void** page = (void**)GetGlobalAllocator()->Alloc((i64)sizeof(void*) + bytes, alignof(void*));
+      checkf(page, "Couldn't allocate Name memory.");
+      if (CharsPage_)
+      {
+        page[0]             = *(void**)CharsPage_;
+        *(void**)CharsPage_ = page;
+      }
+      else
+      {
+        page[0]    = nullptr;
+        CharsPage_ = page; // Left full, the next name opens a regular page
+      }
+      dest = (char*)(page + 1);
+    }
+    else
+    {
+      if (CharsPageUsed_ + bytes > CharsPageSize)
+      {
+        void** page = (void**)GetGlobalAllocator()->Alloc(CharsPageSize, alignof(void*));
+        checkf(page, "Couldn't allocate Name memory.");
+        page[0]        = CharsPage_;
+        CharsPage_     = page;
+        CharsPageUsed_ = (i64)sizeof(void*);
+      }
+      dest = (char*)CharsPage_ + CharsPageUsed_;
+      CharsPageUsed_ += bytes;
+    }
+
+    if (!string.IsEmpty())
+      std::memcpy(dest, string.Data(), (u64)string.Size());
+    dest[string.Size()] = '\0';
+    return dest;
+  }
+
+  static NameIndex* CreateIndex(u64 const slotCount, NameIndex* previous)
+  {
+    auto* index      = (NameIndex*)GetGlobalAllocator()->Alloc((i64)sizeof(NameIndex), alignof(NameIndex));
+    index->Previous_ = previous;
+    index->Mask_     = slotCount - 1;
+    index->Slots_    = (std::atomic<u64>*)GetGlobalAllocator()->Alloc(i64(slotCount * sizeof(u64)), alignof(u64), AllocFlags::Zeroed);
+    checkf(index->Slots_, "Couldn't allocate Name memory.");
+    return index;
+  }
+
+  static void InsertSlot(NameIndex& index, u32 const hash, u32 const entry)
+  {
+    u64 const packed = u64(hash) << 32 | u64(entry + 1);
+    // Triangular probing visits every slot of a power of two table
+    for (u64 i = hash & index.Mask_, step = 1;; i = (i + step++) & index.Mask_)
+    {
+      if (index.Slots_[i].load(std::memory_order_relaxed) == 0)
+      {
+        index.Slots_[i].store(packed, std::memory_order_release);
+        return;
+      }
+    }
+  }
+
+  NameEntry& EntryAt(i32 const entry)
+  {
+    NameEntry* chunk = Chunks_[entry >> ChunkEntriesLog2].load(std::memory_order_acquire);
+    return chunk[entry & (ChunkEntries - 1)];
+  }
+
+public:
+  NameTable()
+  {
+    Index_.store(CreateIndex(1024, nullptr), std::memory_order_relaxed);
+
+    // Entry 0 is None, the empty string
+    std::scoped_lock lock(WriteMutex_);
+    Append(StringView<char>(""), 0);
+  }
+
+  // Lock-free, returns -1 if `string` isn't interned.
+  i32 Find(StringView<char> const string, u32 const hash)
+  {
+    NameIndex const& index = *Index_.load(std::memory_order_acquire);
+    for (u64 i = hash & index.Mask_, step = 1;; i = (i + step++) & index.Mask_)
+    {
+      u64 const slot = index.Slots_[i].load(std::memory_order_acquire);
+      if (slot == 0)
+        return -1;
+
+      if (u32(slot >> 32) == hash)
+      {
+        i32 const        entryIndex = i32(u32(slot) - 1);
+        NameEntry const& entry      = EntryAt(entryIndex);
+        if (entry.Size_ == string.Size() && std::memcmp(entry.Chars_, string.Data(), (u64)string.Size()) == 0)
+          return entryIndex;
+      }
+    }
+  }
+
+  // Shall be called with the write lock held.
+  i32 Append(StringView<char> const string, u32 const hash)
+  {
+    i32 const entryIndex = Count_.load(std::memory_order_relaxed);
+    checkf(entryIndex < MaxChunks * ChunkEntries, "Name table is full.");
+
+    auto& chunk = Chunks_[entryIndex >> ChunkEntriesLog2];
+    if (!chunk.load(std::memory_order_relaxed))
+    {
+      auto* p = (NameEntry*)GetGlobalAllocator()->Alloc(ChunkEntries * (i64)sizeof(NameEntry), alignof(NameEntry));
+      checkf(p, "Couldn't allocate Name memory.");
+      chunk.store(p, std::memory_order_release);
+    }
+    EntryAt(entryIndex) = NameEntry{StoreChars(string), string.Size(), hash};
+
+    // Keeps the load factor under 1/2, probing sequences stay short
+    NameIndex* index = Index_.load(std::memory_order_relaxed);
+    if (u64(entryIndex + 1) * 2 > index->Mask_ + 1)
+    {
+      NameIndex* grown = CreateIndex((index->Mask_ + 1) * 2, index);
+      for (i32 i = 1; i < entryIndex; ++i)
+        InsertSlot(*grown, EntryAt(i).Hash_, u32(i));
+      Index_.store(grown, std::memory_order_release);
+      index = grown;
+    }
+    if (entryIndex != 0)
+      InsertSlot(*index, hash, u32(entryIndex));
+
+    Count_.store(entryIndex + 1, std::memory_order_release);
+    return entryIndex;
+  }
+
+  i32 Intern(StringView<char> const string, u32 const hash)
+  {
+    i32 entryIndex = Find(string, hash);
+    if (entryIndex >= 0)
+      return entryIndex;
+
+    std::scoped_lock lock(WriteMutex_);
+    // Another thread may have interned it meanwhile
+    entryIndex = Find(string, hash);
+    return entryIndex >= 0 ? entryIndex : Append(string, hash);
+  }
+
+  NameEntry const& GetEntry(u32 const entryIndex)
+  {
+    return EntryAt(i32(entryIndex));
+  }
+
+  i32 Count() const
+  {
+    return Count_.load(std::memory_order_acquire);
+  }
+};
+
+NameTable& GetNameTable()
+{
+  // Never destroyed: Names held by statics destroyed after the table still read their characters
+  static NameTable& table = *new NameTable;
+  return table;
+}
+
+u32 HashName(StringView<char> const string)
+{
+  return u32(CalculateHash(string.Data(), string.Size()));
+}
+} // namespace
+
+Name::Name(StringView<char> const string)
+    : Name()
+{
+  if (string.IsEmpty())
+    return;
+
+  u32 const hash = HashName(string);
+  Index_         = u32(GetNameTable().Intern(string, hash));
+  Hash_          = hash;
+}
+
+Name Name::Find(StringView<char> const string)
+{
+  if (string.IsEmpty())
+    return Name();
+
+  u32 const hash       = HashName(string);
+  i32 const entryIndex = GetNameTable().Find(string, hash);
+  return entryIndex >= 0 ? Name(u32(entryIndex), hash) : Name();
+}
+
+i32 Name::InternedCount()
+{
+  return GetNameTable().Count();
+}
+
+StringView<char> Name::AsView() const
+{
+  NameEntry const& entry = GetNameTable().GetEntry(Index_);
+  return StringView<char>(entry.Chars_, entry.Size_);
+}
+
+char const* Name::CStr() const
+{
+  return GetNameTable().GetEntry(Index_).Chars_;
+}
+} // namespace Core
@@ -0,0 +1,66 @@
+#include <Core/Platform/Cpu.h>
+
+#if GE_CPU_X64
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+namespace Core
+{
+#if GE_CPU_X64
+static void Cpuid(i32 (&registers)[4], i32 const leaf)
+{
+#  if defined(_MSC_VER)
+  __cpuidex(registers, leaf, 0);
+#  else
+  __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+#  endif
+}
+
+// Which register states the OS saves on context switches, the wide registers are unusable without it.
+static u64 EnabledRegisterStates()
+{
+#  if defined(_MSC_VER)
+  return _xgetbv(0);
+#  else
+  u32 low  = 0;
+  u32 high = 0;
+  __asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+  return (u64(high) << 32) | low;
+#  endif
+}
+#endif
+
+static CpuFeatures DetectCpuFeatures()
+{
+  CpuFeatures features{};
+#if GE_CPU_X64
+  i32 registers[4] = {};
+  Cpuid(registers, 0);
+  i32 const maxLeaf = registers[0];
+
+  Cpuid(registers, 1);
+  bool const osSavesRegisters = (registers[2] & (1 << 27)) != 0;
+  u64 const  states           = osSavesRegisters ? EnabledRegisterStates() : 0;
+  bool const ymmEnabled       = (states & 0x06) == 0x06;
+  bool const zmmEnabled       = (states & 0xE6) == 0xE6;
+
+  if (maxLeaf >= 7)
+  {
+    Cpuid(registers, 7);
+    features.Avx2_   = ymmEnabled && (registers[1] & (1 << 5)) != 0;
+    features.Avx512_ = zmmEnabled && (registers[1] & (1 << 16)) != 0;
+  }
+#endif
+  return features;
+}
+
+CpuFeatures const& GetCpuFeatures()
+{
+  static CpuFeatures const features = DetectCpuFeatures();
+  return features;
+}
+} // namespace Core
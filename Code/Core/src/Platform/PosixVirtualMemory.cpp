@@ -0,0 +1,35 @@
+#include <Core/Platform/VirtualMemory.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Core::VirtualMemory
+{
+i64 PageSize()
+{
+  static i64 const pageSize = (i64)sysconf(_SC_PAGESIZE);
+  return pageSize;
+}
+
+void* Reserve(i64 const size)
+{
+  void* p = mmap(nullptr, (size_t)size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  return p == MAP_FAILED ? nullptr : p;
+}
+
+bool Commit(void* p, i64 const size)
+{
+  return mprotect(p, (size_t)size, PROT_READ | PROT_WRITE) == 0;
+}
+
+void Decommit(void* p, i64 const size)
+{
+  // MADV_DONTNEED drops the pages, the next access after a Commit will see zeroed memory
+  madvise(p, (size_t)size, MADV_DONTNEED);
+  mprotect(p, (size_t)size, PROT_NONE);
+}
+
+void Release(void* p, i64 const size)
+{
+  munmap(p, (size_t)size);
+}
+} // namespace Core::VirtualMemory
@@ -0,0 +1,37 @@
+#include <Core/Platform/VirtualMemory.h>
+#include <Windows.h>
+
+namespace Core::VirtualMemory
+{
+i64 PageSize()
+{
+  static i64 const pageSize = [] {
+    SYSTEM_INFO info{};
+    GetSystemInfo(&info);
+    return (i64)info.dwPageSize;
+  }();
+  return pageSize;
+}
+
+void* Reserve(i64 const size)
+{
+  return VirtualAlloc(nullptr, (SIZE_T)size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool Commit(void* p, i64 const size)
+{
+  return VirtualAlloc(p, (SIZE_T)size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void Decommit(void* p, i64 const size)
+{
+#pragma warning(suppress : 6'250) // Calling 'VirtualFree' without the MEM_RELEASE flag might free memory but not address descriptors
+  VirtualFree(p, (SIZE_T)size, MEM_DECOMMIT);
+}
+
+void Release(void* p, i64 const size)
+{
+  (void)size;
+  VirtualFree(p, 0, MEM_RELEASE);
+}
+} // namespace Core::VirtualMemory
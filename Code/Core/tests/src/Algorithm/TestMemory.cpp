@@ -0,0 +1,110 @@
+#include <Core/Algorithm/Algorithm.h>
+#include <Core/Algorithm/Memory.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Algorithm)
+{
+  using Core::Algorithm::NonTemporalThreshold;
+
+  // Streamed past the threshold, with a tail shorter than a vector
+  constexpr i64 LargeSize = NonTemporalThreshold + 77;
+
+  Core::LargeVector<u8> Pattern(i64 const size)
+  {
+    Core::LargeVector<u8> bytes;
+    bytes.ResizeUninitialized(size);
+    for (i64 i = 0; i < size; ++i)
+      bytes[i] = u8(i * 31 + i / 251);
+    return bytes;
+  }
+
+  UNIT_TEST(CopyLarge_MisalignedBuffers)
+  {
+    Core::LargeVector<u8> const from = Pattern(LargeSize + 64);
+    Core::LargeVector<u8>       to;
+    to.ResizeUninitialized(LargeSize + 64);
+
+    for (i64 const offset : {0, 1, 13, 33})
+    {
+      Core::Algorithm::CopyLarge(to.Data() + offset, from.Data() + 7, LargeSize);
+      UNIT_TEST_REQUIRE(std::memcmp(to.Data() + offset, from.Data() + 7, LargeSize) == 0);
+    }
+
+    Core::Algorithm::CopyLarge(to.Data(), from.Data(), 100);
+    UNIT_TEST_REQUIRE(std::memcmp(to.Data(), from.Data(), 100) == 0);
+  }
+  UNIT_TEST(CopyLarge_Overlap)
+  {
+    Core::LargeVector<u8> const expected = Pattern(LargeSize + 1'000);
+    Core::LargeVector<u8>       bytes    = expected;
+
+    // Destination after the source, then before it
+    Core::Algorithm::CopyLarge(bytes.Data() + 1'000, bytes.Data(), LargeSize);
+    UNIT_TEST_REQUIRE(std::memcmp(bytes.Data() + 1'000, expected.Data(), LargeSize) == 0);
+
+    bytes = expected;
+    Core::Algorithm::CopyLarge(bytes.Data(), bytes.Data() + 1'000, LargeSize);
+    UNIT_TEST_REQUIRE(std::memcmp(bytes.Data(), expected.Data() + 1'000, LargeSize) == 0);
+  }
+  UNIT_TEST(FillLarge_And_ZeroLarge)
+  {
+    Core::LargeVector<u8> bytes = Pattern(LargeSize + 2);
+
+    Core::Algorithm::FillLarge(bytes.Data() + 1, 0xA5, LargeSize);
+    bool filled = bytes[0] == 0 && bytes[LargeSize + 1] == u8((LargeSize + 1) * 31 + (LargeSize + 1) / 251);
+    for (i64 i = 1; i <= LargeSize; ++i)
+      filled = filled && bytes[i] == 0xA5;
+    UNIT_TEST_REQUIRE(filled);
+
+    Core::Algorithm::ZeroLarge(bytes.Data() + 1, LargeSize);
+    bool zeroed = true;
+    for (i64 i = 1; i <= LargeSize; ++i)
+      zeroed = zeroed && bytes[i] == 0;
+    UNIT_TEST_REQUIRE(zeroed);
+  }
+  UNIT_TEST(LargeMemoryKernels_EachSupportedKernel)
+  {
+    // CopyLarge and FillLarge only run the fastest kernel, the others are called directly. The destinations are
+    // misaligned for every vector width, and the sizes leave tails of a few bytes up to almost a whole block.
+    Core::LargeVector<u8> const from = Pattern(LargeSize + 16'384 + 64);
+    Core::LargeVector<u8>       to;
+    to.ResizeUninitialized(LargeSize + 16'384 + 64);
+
+    auto const kernels = Core::Algorithm::Private::SupportedLargeMemoryKernels();
+    UNIT_TEST_REQUIRE(kernels.Size() >= 1);
+    UNIT_TEST_REQUIRE(std::strcmp(kernels[kernels.Size() - 1].Name_, "CRT") == 0);
+
+    for (auto const& kernel : kernels)
+    {
+      for (i64 const size : {LargeSize, NonTemporalThreshold + 16'383})
+      {
+        for (i64 const offset : {0, 1, 13, 33})
+        {
+          kernel.Copy_(to.Data() + offset, from.Data() + 7, size);
+          UNIT_TEST_REQUIRE(std::memcmp(to.Data() + offset, from.Data() + 7, size) == 0);
+
+          to[offset + size] = 0x5A;
+          kernel.Fill_(to.Data() + offset, 0xA5, size);
+          bool filled = to[offset + size] == 0x5A;
+          for (i64 i = 0; i < size; ++i)
+            filled = filled && to[offset + i] == 0xA5;
+          UNIT_TEST_REQUIRE(filled);
+        }
+      }
+    }
+  }
+  UNIT_TEST(Copy_OverlappingRanges)
+  {
+    // The destination starting before the source used to go to memcpy
+    i32 items[8]    = {0, 1, 2, 3, 4, 5, 6, 7};
+    i32 expected[8] = {2, 3, 4, 5, 6, 7, 6, 7};
+    Core::Algorithm::Copy(items + 2, items + 8, items);
+    UNIT_TEST_REQUIRE(std::memcmp(items, expected, sizeof(items)) == 0);
+
+    i32 shifted[8] = {0, 1, 0, 1, 2, 3, 4, 5};
+    i32 values[8]  = {0, 1, 2, 3, 4, 5, 6, 7};
+    Core::Algorithm::Copy(values, values + 6, values + 2);
+    UNIT_TEST_REQUIRE(std::memcmp(values, shifted, sizeof(values)) == 0);
+  }
+}
@@ -0,0 +1,131 @@
+#include <Core/Algorithm/Scan.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+#include "ThreadTaskPool.h"
+
+UNIT_TEST_SUITE(Algorithm)
+{
+  using Core::Span;
+  using Core::Vector;
+
+  template <typename T>
+  Vector<T> Sequence(i32 const count)
+  {
+    Vector<T> items;
+    for (i32 i = 0; i < count; ++i)
+      items.EmplaceBack(T((i * 7 + 3) % 11));
+    return items;
+  }
+
+  template <typename T>
+  bool ScansMatch(i32 const count, Core::ITaskPool* pool)
+  {
+    Vector<T> items = Sequence<T>(count);
+    Vector<T> inclusive;
+    Vector<T> exclusive;
+    inclusive.ResizeUninitialized(count);
+    exclusive.ResizeUninitialized(count);
+
+    T const inclusiveTotal = Core::Algorithm::InclusiveScan(Span<T const>(items), Span<T>(inclusive), pool);
+    T const exclusiveTotal = Core::Algorithm::ExclusiveScan(Span<T const>(items), Span<T>(exclusive), T(5), pool);
+
+    T sum = T();
+    for (i32 i = 0; i < count; ++i)
+    {
+      if (exclusive[i] != sum + T(5))
+        return false;
+      sum += items[i];
+      if (inclusive[i] != sum)
+        return false;
+    }
+    return inclusiveTotal == sum && exclusiveTotal == sum + T(5);
+  }
+
+  UNIT_TEST(Scan_MatchesSerialSum)
+  {
+    // Sizes around the vector widths, so the kernels and their scalar tails are both covered
+    for (i32 const count : {0, 1, 3, 4, 7, 8, 9, 17, 1'000})
+    {
+      UNIT_TEST_REQUIRE(ScansMatch<i32>(count, nullptr));
+      UNIT_TEST_REQUIRE(ScansMatch<u32>(count, nullptr));
+      UNIT_TEST_REQUIRE(ScansMatch<i64>(count, nullptr));
+      UNIT_TEST_REQUIRE(ScansMatch<u64>(count, nullptr));
+      UNIT_TEST_REQUIRE(ScansMatch<f32>(count, nullptr));
+    }
+  }
+  UNIT_TEST(Scan_InPlace)
+  {
+    Vector<u32> offsets{3u, 0u, 2u, 5u, 1u, 1u, 4u, 0u, 2u};
+    Vector<u32> expected{0u, 3u, 3u, 5u, 10u, 11u, 12u, 16u, 16u};
+    u32 const   total = Core::Algorithm::ExclusiveScan(Span<u32 const>(offsets), Span<u32>(offsets));
+    UNIT_TEST_REQUIRE(total == 18);
+    UNIT_TEST_REQUIRE(offsets == expected);
+
+    Core::Algorithm::InclusiveScan(Span<u32 const>(offsets), Span<u32>(offsets));
+    UNIT_TEST_REQUIRE(offsets[8] == 76);
+  }
+  UNIT_TEST(Scan_Parallel)
+  {
+    ThreadTaskPool pool(4);
+    UNIT_TEST_REQUIRE(ScansMatch<u32>(300'001, &pool));
+    UNIT_TEST_REQUIRE(ScansMatch<i64>(300'001, &pool));
+  }
+  UNIT_TEST(Compact_KeepsOrder)
+  {
+    for (i32 const count : {0, 5, 8, 33, 1'000})
+    {
+      Vector<u32> items = Sequence<u32>(count);
+      Vector<u64> wide;
+      for (u32 const item : items)
+        wide.EmplaceBack(u64(item) << 40 | item);
+
+      // Existing items are kept, the new ones are appended
+      Vector<u32> odd{42u};
+      i32 const   kept = Core::Algorithm::Compact(Span<u32 const>(items), [](u32 const item) { return item % 2 == 1; }, odd);
+      Vector<u64> small;
+      Core::Algorithm::Compact(Span<u64>(wide), [](u64 const item) { return (item & 0xFF) < 4; }, small);
+
+      Vector<u32> expectedOdd{42u};
+      Vector<u64> expectedSmall;
+      for (u32 const item : items)
+      {
+        if (item % 2 == 1)
+          expectedOdd.EmplaceBack(item);
+        if (item < 4)
+          expectedSmall.EmplaceBack(u64(item) << 40 | item);
+      }
+      UNIT_TEST_REQUIRE(kept == expectedOdd.Size() - 1);
+      UNIT_TEST_REQUIRE(odd == expectedOdd);
+      UNIT_TEST_REQUIRE(small == expectedSmall);
+    }
+  }
+  UNIT_TEST(Compact_Parallel)
+  {
+    struct Particle
+    {
+      f32 Position_;
+      f32 Life_;
+    };
+
+    Vector<Particle> particles;
+    for (i32 i = 0; i < 200'003; ++i)
+      particles.EmplaceBack(Particle{f32(i), f32(i % 13) - 6.0f});
+
+    ThreadTaskPool   pool(4);
+    Vector<Particle> alive;
+    auto const       isAlive = [](Particle const& particle) { return particle.Life_ > 0.0f; };
+    i32 const        kept    = Core::Algorithm::Compact(Span<Particle const>(particles), isAlive, alive, &pool);
+
+    i32  expected = 0;
+    bool inOrder  = true;
+    for (Particle const& particle : particles)
+    {
+      if (isAlive(particle))
+        inOrder = inOrder && expected < alive.Size() && alive[expected++].Position_ == particle.Position_;
+    }
+    UNIT_TEST_REQUIRE(kept == expected);
+    UNIT_TEST_REQUIRE(alive.Size() == expected);
+    UNIT_TEST_REQUIRE(inOrder);
+  }
+}
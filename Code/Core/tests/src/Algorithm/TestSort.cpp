@@ -0,0 +1,109 @@
+#include <Core/Algorithm/Sort.h>
+#include <Core/Container/String.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+#include <algorithm>
+
+#include "ThreadTaskPool.h"
+
+UNIT_TEST_SUITE(Algorithm)
+{
+  using Core::Span;
+  using Core::Vector;
+
+  Vector<u64> RandomKeys(i32 const count, u64 const mask)
+  {
+    Vector<u64> keys;
+    u64         seed = 0x9E37'79B9'7F4A'7C15ull;
+    for (i32 i = 0; i < count; ++i)
+    {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+      keys.EmplaceBack(seed & mask);
+    }
+    return keys;
+  }
+
+  UNIT_TEST(Sort_SpanAndVector)
+  {
+    Vector<u64> keys     = RandomKeys(5'000, ~0ull);
+    Vector<u64> expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    Core::Algorithm::Sort(keys);
+    UNIT_TEST_REQUIRE(keys == expected);
+
+    Core::Algorithm::Sort(Span<u64>(keys), std::greater<u64>());
+    UNIT_TEST_REQUIRE(std::is_sorted(keys.begin(), keys.end(), std::greater<u64>()));
+
+    Vector<Core::String<char>> names{"delta", "a string long enough to live on the heap", "charlie", "ab"};
+    Core::Algorithm::Sort(names, [](auto const& a, auto const& b) { return a.Size() < b.Size(); });
+    UNIT_TEST_REQUIRE(names[0] == "ab");
+    UNIT_TEST_REQUIRE(names[2] == "charlie");
+    UNIT_TEST_REQUIRE(names[3] == "a string long enough to live on the heap");
+  }
+  UNIT_TEST(RadixSort_Keys)
+  {
+    // Narrow keys skip the passes of their empty high bytes
+    for (u64 const mask : {~0ull, 0xFFFFull, 0xFF00'0000'00FFull})
+    {
+      Vector<u64> keys     = RandomKeys(10'000, mask);
+      Vector<u64> expected = keys;
+      std::sort(expected.begin(), expected.end());
+      Core::Algorithm::RadixSort(keys);
+      UNIT_TEST_REQUIRE(keys == expected);
+    }
+
+    Vector<u32> small{5u, 3u, 0xFFFF'FFFFu, 0u, 3u};
+    Core::Algorithm::RadixSort(Span<u32>(small));
+    UNIT_TEST_REQUIRE(small[0] == 0);
+    UNIT_TEST_REQUIRE(small[2] == 3);
+    UNIT_TEST_REQUIRE(small[4] == 0xFFFF'FFFFu);
+  }
+  UNIT_TEST(RadixSort_PairsAreStable)
+  {
+    struct Pair
+    {
+      u32 A_;
+      u32 B_;
+    };
+
+    Vector<u32>  keys;
+    Vector<Pair> values;
+    for (u32 i = 0; i < 1'000; ++i)
+    {
+      keys.EmplaceBack((i * 7'919u) % 10u);
+      values.EmplaceBack(Pair{i, keys.Back()});
+    }
+
+    Core::Algorithm::RadixSort(keys, values);
+    for (i32 i = 1; i < keys.Size(); ++i)
+    {
+      UNIT_TEST_REQUIRE(keys[i - 1] <= keys[i]);
+      UNIT_TEST_REQUIRE(values[i].B_ == keys[i]);
+      if (keys[i - 1] == keys[i])
+        UNIT_TEST_REQUIRE(values[i - 1].A_ < values[i].A_);
+    }
+  }
+  UNIT_TEST(ParallelSort_MatchesSort)
+  {
+    ThreadTaskPool pool(3);
+
+    // Enough items for 3 runs, so the odd run is carried over a round
+    Vector<u64> keys     = RandomKeys(100'000, 0xFFFFull);
+    Vector<u64> expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    Core::Algorithm::ParallelSort(keys, &pool);
+    UNIT_TEST_REQUIRE(keys == expected);
+
+    Core::Algorithm::ParallelSort(Span<u64>(keys), &pool, std::greater<u64>());
+    UNIT_TEST_REQUIRE(std::is_sorted(keys.begin(), keys.end(), std::greater<u64>()));
+
+    // Without a pool it's a plain Sort
+    Vector<u64> serial = RandomKeys(1'000, ~0ull);
+    Core::Algorithm::ParallelSort(serial, nullptr);
+    UNIT_TEST_REQUIRE(std::is_sorted(serial.begin(), serial.end()));
+  }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Core/Concurrency/TaskPool.h>
+#include <Core/Definitions.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace UnitTest
+{
+// Spawns its threads for every batch, enough to exercise the parallel paths
+struct ThreadTaskPool : Core::ITaskPool
+{
+  i32 Threads_;
+
+  explicit ThreadTaskPool(i32 const threads)
+      : Threads_(threads)
+  {
+  }
+
+  i32 Concurrency() override
+  {
+    return Threads_;
+  }
+
+  void ParallelFor(i32 const count, std::function<void(i32)> const& task) override
+  {
+    std::atomic<i32> next = 0;
+    auto             work = [&] {
+      for (i32 i = next++; i < count; i = next++)
+        task(i);
+    };
+
+    std::vector<std::thread> workers;
+    for (i32 i = 1; i < Threads_; ++i)
+      workers.emplace_back(work);
+    work();
+    for (std::thread& worker : workers)
+      worker.join();
+  }
+};
+} // namespace UnitTest
@@ -0,0 +1,120 @@
+#include <Core/Allocator/FrameAllocator.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Allocator)
+{
+  using Core::FrameAllocator;
+
+  UNIT_TEST(FrameAllocator_Free_NullptrNeverCrashes)
+  {
+    FrameAllocator alloc(1'024);
+    alloc.Free(nullptr, 0);
+  }
+  UNIT_TEST(FrameAllocator_Alloc_IsLinear)
+  {
+    FrameAllocator alloc(1'024);
+    u8*            p0 = (u8*)alloc.Alloc(16, 16);
+    u8*            p1 = (u8*)alloc.Alloc(16, 16);
+    UNIT_TEST_REQUIRE(p0 && p1);
+    UNIT_TEST_REQUIRE(p1 == p0 + 16);
+    UNIT_TEST_REQUIRE(alloc.GetStats().UsedBytes_ == 32);
+  }
+  UNIT_TEST(FrameAllocator_Alloc_IncreasedAlignment)
+  {
+    FrameAllocator alloc(64 * 1'024);
+    for (i32 align = 1; align < 4'096; align *= 2)
+    {
+      void* p = alloc.Alloc(1, align);
+      UNIT_TEST_REQUIRE(p);
+      UNIT_TEST_REQUIRE(((u64)p & u64(align - 1)) == 0);
+    }
+  }
+  UNIT_TEST(FrameAllocator_Alloc_OverflowChainsBlocks)
+  {
+    FrameAllocator alloc(256);
+    for (i32 i = 0; i < 16; ++i)
+    {
+      u8* p = (u8*)alloc.Alloc(100, 8);
+      UNIT_TEST_REQUIRE(p);
+      p[99] = 0xFF;
+    }
+    auto const stats = alloc.GetStats();
+    UNIT_TEST_REQUIRE(stats.BlockCount_ > 1);
+    UNIT_TEST_REQUIRE(stats.OverflowCount_ == stats.BlockCount_ - 1);
+  }
+  UNIT_TEST(FrameAllocator_Alloc_BiggerThanBlockSize)
+  {
+    FrameAllocator alloc(64);
+    u8*            p = (u8*)alloc.Alloc(1'024, 8);
+    UNIT_TEST_REQUIRE(p);
+    p[1'023] = 0xFF;
+  }
+  UNIT_TEST(FrameAllocator_BeginFrame_CollapsesChainToHighWaterMark)
+  {
+    FrameAllocator alloc(256);
+    for (i32 i = 0; i < 16; ++i)
+      alloc.Alloc(100, 8);
+    i64 const peak = alloc.GetStats().HighWaterMark_;
+
+    // Frame N+1 uses the other buffer, frame N+2 reuses the one that overflowed
+    alloc.BeginFrame();
+    alloc.BeginFrame();
+
+    auto const stats = alloc.GetStats();
+    UNIT_TEST_REQUIRE(stats.UsedBytes_ == 0);
+    UNIT_TEST_REQUIRE(stats.HighWaterMark_ == peak);
+    UNIT_TEST_REQUIRE(stats.BlockCount_ == 1);
+
+    for (i32 i = 0; i < 16; ++i)
+      alloc.Alloc(100, 8);
+    UNIT_TEST_REQUIRE(alloc.GetStats().BlockCount_ == 1);
+  }
+  UNIT_TEST(FrameAllocator_BeginFrame_PreviousFrameStaysValid)
+  {
+    FrameAllocator alloc(1'024);
+    i32*           p = (i32*)alloc.Alloc(sizeof(i32), alignof(i32));
+    *p               = 0xBE'EF;
+    alloc.BeginFrame();
+    i32* q = (i32*)alloc.Alloc(sizeof(i32), alignof(i32));
+    *q     = 0;
+    UNIT_TEST_REQUIRE(*p == 0xBE'EF);
+    UNIT_TEST_REQUIRE(p != q);
+  }
+  UNIT_TEST(FrameAllocator_Realloc_GrowsLastAllocationInPlace)
+  {
+    FrameAllocator alloc(1'024);
+    void*          p = alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 64, 8) == p);
+    UNIT_TEST_REQUIRE(alloc.GetStats().UsedBytes_ == 64);
+  }
+  UNIT_TEST(FrameAllocator_Realloc_FailsIfNotLastAllocation)
+  {
+    FrameAllocator alloc(1'024);
+    void*          p = alloc.Alloc(16, 8);
+    alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE_FALSE(alloc.Realloc(p, 64, 8));
+  }
+  UNIT_TEST(FrameAllocator_Free_RewindsLastAllocation)
+  {
+    FrameAllocator alloc(1'024);
+    void*          p0 = alloc.Alloc(16, 8);
+    void*          p1 = alloc.Alloc(16, 8);
+    alloc.Free(p1, 8);
+    UNIT_TEST_REQUIRE(alloc.GetStats().UsedBytes_ == 16);
+    alloc.Free(p0, 8);
+    UNIT_TEST_REQUIRE(alloc.GetStats().UsedBytes_ == 16);
+  }
+  UNIT_TEST(FrameAllocator_Vector_GrowsWithoutCopies)
+  {
+    FrameAllocator alloc(64 * 1'024);
+    Core::Vector<i32> v(&alloc);
+    v.EmplaceBack(0);
+    i32* const mem = v.Data();
+    for (i32 i = 1; i < 1'024; ++i)
+      v.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(v.Data() == mem);
+    for (i32 i = 0; i < v.Size(); ++i)
+      UNIT_TEST_REQUIRE(v[i] == i);
+  }
+}
@@ -0,0 +1,61 @@
+#include <Core/Allocator/PoolAllocator.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Allocator)
+{
+  using Core::PoolAllocator;
+
+  UNIT_TEST(PoolAllocator_Free_NullptrNeverCrashes)
+  {
+    PoolAllocator<16> pool;
+    pool.Free(nullptr, 0);
+  }
+  UNIT_TEST(PoolAllocator_Alloc_SlotsAreContiguous)
+  {
+    using Pool = PoolAllocator<32, 16>;
+    Pool pool;
+    u8*  p0 = (u8*)pool.Alloc(32, 16);
+    u8*  p1 = (u8*)pool.Alloc(32, 16);
+    UNIT_TEST_REQUIRE(p0 && p1);
+    UNIT_TEST_REQUIRE(p1 == p0 + Pool::SlotSize);
+    UNIT_TEST_REQUIRE(((u64)p0 & 15) == 0);
+    UNIT_TEST_REQUIRE(pool.LiveCount() == 2);
+  }
+  UNIT_TEST(PoolAllocator_Alloc_TooBigFails)
+  {
+    PoolAllocator<8> pool;
+    UNIT_TEST_REQUIRE_FALSE(pool.Alloc(9, 8));
+    UNIT_TEST_REQUIRE(pool.LiveCount() == 0);
+  }
+  UNIT_TEST(PoolAllocator_Free_ReusesLastFreedSlot)
+  {
+    PoolAllocator<24> pool;
+    void*             p0 = pool.Alloc(24, 8);
+    void*             p1 = pool.Alloc(24, 8);
+    pool.Free(p0, 8);
+    UNIT_TEST_REQUIRE(pool.LiveCount() == 1);
+    UNIT_TEST_REQUIRE(pool.Alloc(24, 8) == p0);
+    pool.Free(p1, 8);
+    UNIT_TEST_REQUIRE(pool.Alloc(24, 8) == p1);
+  }
+  UNIT_TEST(PoolAllocator_Alloc_AddsPagesWhenFull)
+  {
+    using Pool = PoolAllocator<64, 8, 1'024>;
+    Pool pool;
+    for (i32 i = 0; i < Pool::SlotsPerPage * 3; ++i)
+    {
+      u8* p = (u8*)pool.Alloc(64, 8);
+      UNIT_TEST_REQUIRE(p);
+      p[63] = 0xFF;
+    }
+    UNIT_TEST_REQUIRE(pool.PageCount() == 3);
+    UNIT_TEST_REQUIRE(pool.LiveCount() == Pool::SlotsPerPage * 3);
+  }
+  UNIT_TEST(PoolAllocator_Realloc_OnlyWithinSlot)
+  {
+    PoolAllocator<16> pool;
+    void*             p = pool.Alloc(4, 4);
+    UNIT_TEST_REQUIRE(pool.Realloc(p, 16, 4) == p);
+    UNIT_TEST_REQUIRE_FALSE(pool.Realloc(p, 17, 4));
+  }
+}
@@ -0,0 +1,125 @@
+#include <Core/Allocator/StackAllocator.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Allocator)
+{
+  using Core::InlineStackAllocator;
+  using Core::StackAllocator;
+
+  UNIT_TEST(StackAllocator_Free_NullptrNeverCrashes)
+  {
+    StackAllocator alloc(64);
+    alloc.Free(nullptr, 0);
+  }
+  UNIT_TEST(StackAllocator_Alloc_ManyAllocations)
+  {
+    InlineStackAllocator<256> alloc;
+    u8*                       p0 = (u8*)alloc.Alloc(16, 8);
+    u8*                       p1 = (u8*)alloc.Alloc(16, 8);
+    u8*                       p2 = (u8*)alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE(alloc.Owns(p0) && alloc.Owns(p1) && alloc.Owns(p2));
+    UNIT_TEST_REQUIRE(p1 == p0 + 16 && p2 == p1 + 16);
+    UNIT_TEST_REQUIRE(alloc.Used() == 48);
+  }
+  UNIT_TEST(StackAllocator_Alloc_IncreasedAlignment)
+  {
+    StackAllocator alloc(16 * 1'024);
+    for (i32 align = 1; align < 4'096; align *= 2)
+    {
+      void* p = alloc.Alloc(1, align);
+      UNIT_TEST_REQUIRE(alloc.Owns(p));
+      UNIT_TEST_REQUIRE(((u64)p & u64(align - 1)) == 0);
+    }
+  }
+  UNIT_TEST(StackAllocator_Alloc_FallbacksToParentWhenFull)
+  {
+    InlineStackAllocator<64> alloc;
+    void*                    p0 = alloc.Alloc(48, 8);
+    void*                    p1 = alloc.Alloc(48, 8);
+    UNIT_TEST_REQUIRE(alloc.Owns(p0));
+    UNIT_TEST_REQUIRE(p1);
+    UNIT_TEST_REQUIRE_FALSE(alloc.Owns(p1));
+    alloc.Free(p1, 8);
+  }
+  UNIT_TEST(StackAllocator_Alloc_ZeroSizeReturnsNullptr)
+  {
+    // With the buffer full, the cursor sits one past its end
+    StackAllocator alloc(64);
+    alloc.Alloc(64, 8);
+    UNIT_TEST_REQUIRE(alloc.Alloc(0, 8) == nullptr);
+    UNIT_TEST_REQUIRE(alloc.Used() == 64);
+    alloc.Free(alloc.Alloc(0, 1), 1);
+  }
+  UNIT_TEST(StackAllocator_Alloc_ZeroedFlag)
+  {
+    InlineStackAllocator<256> alloc;
+    u8*                       p = (u8*)alloc.Alloc(64, 8);
+    for (i32 i = 0; i < 64; ++i)
+      p[i] = 0xFF;
+    alloc.Free(p, 8);
+
+    p = (u8*)alloc.Alloc(64, 8, Core::AllocFlags::Zeroed);
+    for (i32 i = 0; i < 64; ++i)
+      UNIT_TEST_REQUIRE(p[i] == 0);
+  }
+  UNIT_TEST(StackAllocator_Rewind_ReleasesEverythingAfterMarker)
+  {
+    InlineStackAllocator<256> alloc;
+    alloc.Alloc(16, 8);
+    auto const marker = alloc.GetMarker();
+    alloc.Alloc(16, 8);
+    alloc.Alloc(16, 8);
+    alloc.Rewind(marker);
+    UNIT_TEST_REQUIRE(alloc.Used() == 16);
+  }
+  UNIT_TEST(StackAllocator_ScopedMarker_RewindsOnScopeExit)
+  {
+    InlineStackAllocator<256> alloc;
+    {
+      StackAllocator::ScopedMarker scope(alloc);
+      Core::Vector<i32>            v(&alloc);
+      for (i32 i = 0; i < 32; ++i)
+        v.EmplaceBack(i);
+      UNIT_TEST_REQUIRE(alloc.Used() > 0);
+    }
+    UNIT_TEST_REQUIRE(alloc.Used() == 0);
+  }
+  UNIT_TEST(StackAllocator_Realloc_GrowsTopAllocationInPlace)
+  {
+    InlineStackAllocator<256> alloc;
+    void*                     p = alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 128, 8) == p);
+    UNIT_TEST_REQUIRE(alloc.Used() == 128);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 32, 8) == p);
+    UNIT_TEST_REQUIRE(alloc.Used() == 32);
+    UNIT_TEST_REQUIRE_FALSE(alloc.Realloc(p, 512, 8));
+  }
+  UNIT_TEST(StackAllocator_Realloc_FailsIfNotTop)
+  {
+    InlineStackAllocator<256> alloc;
+    void*                     p = alloc.Alloc(16, 8);
+    alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE_FALSE(alloc.Realloc(p, 32, 8));
+  }
+  UNIT_TEST(StackAllocator_Free_PopsTopAllocation)
+  {
+    InlineStackAllocator<256> alloc;
+    alloc.Alloc(16, 8);
+    void* p = alloc.Alloc(16, 8);
+    alloc.Free(p, 8);
+    UNIT_TEST_REQUIRE(alloc.Used() == 16);
+  }
+  UNIT_TEST(StackAllocator_Vector_GrowsInPlace)
+  {
+    StackAllocator    alloc(64 * 1'024);
+    Core::Vector<i32> v(&alloc);
+    v.EmplaceBack(0);
+    i32* const mem = v.Data();
+    for (i32 i = 1; i < 1'024; ++i)
+      v.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(v.Data() == mem);
+    for (i32 i = 0; i < v.Size(); ++i)
+      UNIT_TEST_REQUIRE(v[i] == i);
+  }
+}
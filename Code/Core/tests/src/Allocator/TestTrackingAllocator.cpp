@@ -0,0 +1,96 @@
+#include <Core/Allocator/StackAllocator.h>
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Allocator)
+{
+  using Core::MemoryTag;
+  using Core::TrackingAllocator;
+
+  UNIT_TEST(TrackingAllocator_Free_NullptrNeverCrashes)
+  {
+    TrackingAllocator alloc;
+    alloc.Free(nullptr, 0);
+  }
+  UNIT_TEST(TrackingAllocator_Alloc_IncreasedAlignment)
+  {
+    TrackingAllocator alloc;
+    for (i32 align = 1; align < 4'096; align *= 2)
+    {
+      void* p = alloc.Alloc(1, align);
+      UNIT_TEST_REQUIRE(((u64)p & u64(align - 1)) == 0);
+      alloc.Free(p, align);
+    }
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveCount_ == 0);
+  }
+  UNIT_TEST(TrackingAllocator_Alloc_AttributedToFixedTag)
+  {
+    TrackingAllocator     alloc(Core::GetGlobalAllocator(), MemoryTag::Physics);
+    Core::ScopedMemoryTag scope(MemoryTag::Renderer);
+    void*                 p = alloc.Alloc(100, 8);
+
+    TrackingAllocator::Stats const stats = alloc.GetStats(MemoryTag::Physics);
+    UNIT_TEST_REQUIRE(stats.LiveBytes_ == 100);
+    UNIT_TEST_REQUIRE(stats.LiveCount_ == 1);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Renderer).AllocCount_ == 0);
+    alloc.Free(p, 8);
+  }
+  UNIT_TEST(TrackingAllocator_Alloc_AttributedToThreadTag)
+  {
+    TrackingAllocator alloc;
+    void*             p0 = alloc.Alloc(16, 8);
+    void*             p1;
+    {
+      Core::ScopedMemoryTag scope(MemoryTag::ECS);
+      p1 = alloc.Alloc(32, 8);
+    }
+    UNIT_TEST_REQUIRE(Core::GetCurrentMemoryTag() == MemoryTag::Untagged);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Untagged).LiveBytes_ == 16);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::ECS).LiveBytes_ == 32);
+
+    // Frees are accounted to the tag of the allocation, not the current one
+    alloc.Free(p1, 8);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::ECS).LiveBytes_ == 0);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::ECS).PeakBytes_ == 32);
+    alloc.Free(p0, 8);
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveBytes_ == 0);
+  }
+  UNIT_TEST(TrackingAllocator_Realloc_UpdatesLiveBytes)
+  {
+    Core::InlineStackAllocator<1'024> inner;
+    TrackingAllocator                 alloc(&inner, MemoryTag::Core);
+    void*                             p = alloc.Alloc(64, 8);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 256, 8) == p);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Core).LiveBytes_ == 256);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 32, 8) == p);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Core).LiveBytes_ == 32);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Core).PeakBytes_ == 256);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Core).AllocCount_ == 1);
+  }
+  UNIT_TEST(TrackingAllocator_Histogram_PowerOf2Buckets)
+  {
+    UNIT_TEST_REQUIRE(TrackingAllocator::GetHistogramBucket(0) == 0);
+    UNIT_TEST_REQUIRE(TrackingAllocator::GetHistogramBucket(16) == 0);
+    UNIT_TEST_REQUIRE(TrackingAllocator::GetHistogramBucket(17) == 1);
+    UNIT_TEST_REQUIRE(TrackingAllocator::GetHistogramBucket(32) == 1);
+    UNIT_TEST_REQUIRE(TrackingAllocator::GetHistogramBucket(1ll << 40) == TrackingAllocator::HistogramBuckets - 1);
+
+    TrackingAllocator alloc(Core::GetGlobalAllocator(), MemoryTag::Logging);
+    void*             p = alloc.Alloc(1'000, 8);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Logging).Histogram_[TrackingAllocator::GetHistogramBucket(1'000)] == 1);
+    alloc.Free(p, 8);
+  }
+  UNIT_TEST(TrackingAllocator_Vector_TracksContainerMemory)
+  {
+    TrackingAllocator alloc(Core::GetGlobalAllocator(), MemoryTag::Engine);
+    {
+      Core::Vector<i32> v(&alloc);
+      for (i32 i = 0; i < 100; ++i)
+        v.EmplaceBack(i);
+      UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Engine).LiveBytes_ >= 100 * (i64)sizeof(i32));
+    }
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Engine).LiveBytes_ == 0);
+    UNIT_TEST_REQUIRE(alloc.GetStats(MemoryTag::Engine).LiveCount_ == 0);
+  }
+}
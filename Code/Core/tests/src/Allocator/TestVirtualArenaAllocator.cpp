@@ -0,0 +1,66 @@
+#include <Core/Allocator/VirtualArenaAllocator.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Allocator)
+{
+  using Core::VirtualArenaAllocator;
+
+  constexpr i64 ReserveSize = 256 * 1'024 * 1'024;
+
+  UNIT_TEST(VirtualArenaAllocator_Free_NullptrNeverCrashes)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    alloc.Free(nullptr, 0);
+  }
+  UNIT_TEST(VirtualArenaAllocator_IsNotCopyable)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    UNIT_TEST_REQUIRE_FALSE(alloc.IsCopyable());
+  }
+  UNIT_TEST(VirtualArenaAllocator_Alloc_CommitsOnDemand)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    UNIT_TEST_REQUIRE(alloc.Reserved() >= ReserveSize);
+    UNIT_TEST_REQUIRE(alloc.Committed() == 0);
+
+    u8* p = (u8*)alloc.Alloc(100, 8);
+    UNIT_TEST_REQUIRE(p);
+    p[99] = 0xFF;
+    UNIT_TEST_REQUIRE(alloc.Committed() >= 100);
+    UNIT_TEST_REQUIRE(alloc.Committed() < ReserveSize);
+  }
+  UNIT_TEST(VirtualArenaAllocator_Alloc_FailsPastReservation)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    UNIT_TEST_REQUIRE_FALSE(alloc.Alloc(alloc.Reserved() + 1, 8));
+  }
+  UNIT_TEST(VirtualArenaAllocator_Realloc_GrowsTopAllocationInPlace)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    u8*                   p = (u8*)alloc.Alloc(16, 8);
+    UNIT_TEST_REQUIRE(alloc.Realloc(p, 64 * 1'024 * 1'024, 8) == p);
+    p[64 * 1'024 * 1'024 - 1] = 0xFF;
+    UNIT_TEST_REQUIRE(alloc.Used() == 64 * 1'024 * 1'024);
+  }
+  UNIT_TEST(VirtualArenaAllocator_Free_DecommitsTopAllocation)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    void*                 p = alloc.Alloc(16 * 1'024 * 1'024, 8);
+    UNIT_TEST_REQUIRE(p);
+    alloc.Free(p, 8);
+    UNIT_TEST_REQUIRE(alloc.Used() == 0);
+    UNIT_TEST_REQUIRE(alloc.Committed() == 0);
+  }
+  UNIT_TEST(VirtualArenaAllocator_Vector_NeverMovesWhenGrowing)
+  {
+    VirtualArenaAllocator alloc(ReserveSize);
+    Core::Vector<i64>     v(&alloc);
+    v.EmplaceBack(0);
+    i64* const mem = v.Data();
+    for (i64 i = 1; i < 1'024 * 1'024; ++i)
+      v.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(v.Data() == mem);
+    UNIT_TEST_REQUIRE(v.Back() == 1'024 * 1'024 - 1);
+  }
+}
@@ -1,9 +1,28 @@
-#include <Core/Allocator/Allocator.h>
+#include <Core/Allocator/GlobalAllocator.h>
 #include <UnitTest/UnitTest.h>
 #include <Windows.h>
 
 UNIT_TEST_SUITE(Allocator)
 {
+  using Core::GlobalAllocator;
+  using Core::GlobalAllocatorBackend;
+
+  template <typename Fn>
+  static bool ForEachBackend(Fn&& fn)
+  {
+    for (i32 i = 0; i < (i32)GlobalAllocatorBackend::Count; ++i)
+    {
+      auto const backend = (GlobalAllocatorBackend)i;
+      if (GlobalAllocator::IsBackendAvailable(backend))
+      {
+        GlobalAllocator alloc(backend);
+        if (!fn(alloc))
+          return false;
+      }
+    }
+    return true;
+  }
+
   UNIT_TEST(GlobalAllocator_Free_NullptrNeverCrashes)
   {
     Core::GetGlobalAllocator()->Free(nullptr, 0);
@@ -51,4 +70,58 @@ UNIT_TEST_SUITE(Allocator)
       Core::GetGlobalAllocator()->Free(p, 32);
     }
   }
+  UNIT_TEST(GlobalAllocator_Backend_InstanceIsAvailable)
+  {
+    UNIT_TEST_REQUIRE(GlobalAllocator::IsBackendAvailable(GlobalAllocator::GetInstance().GetBackend()));
+    UNIT_TEST_REQUIRE(GlobalAllocator::IsBackendAvailable(GlobalAllocatorBackend::Malloc));
+  }
+  UNIT_TEST(GlobalAllocator_Backend_AllocIncreasedAlignment)
+  {
+    bool const ok = ForEachBackend([](GlobalAllocator& alloc) {
+      for (i32 align = 1; align < 4'096; align *= 2)
+      {
+        u8* p = (u8*)alloc.Alloc(align * 2, align);
+        if (!p || ((u64)p & u64(align - 1)) != 0)
+          return false;
+        p[align * 2 - 1] = 0xFF;
+        alloc.Free(p, align);
+      }
+      return true;
+    });
+    UNIT_TEST_REQUIRE(ok);
+  }
+  UNIT_TEST(GlobalAllocator_Backend_AllocZeroed)
+  {
+    bool const ok = ForEachBackend([](GlobalAllocator& alloc) {
+      for (i32 align : {8, 64})
+      {
+        u8* p = (u8*)alloc.Alloc(4'096, align, Core::AllocFlags::Zeroed);
+        for (i32 i = 0; i < 4'096; ++i)
+        {
+          if (p[i] != 0)
+            return false;
+        }
+        alloc.Free(p, align);
+      }
+      return true;
+    });
+    UNIT_TEST_REQUIRE(ok);
+  }
+  UNIT_TEST(GlobalAllocator_Backend_ReallocNeverMoves)
+  {
+    bool const ok = ForEachBackend([](GlobalAllocator& alloc) {
+      void* p = alloc.Alloc(1'000, 8);
+      for (i64 size = 1'000; size < 1'024 * 1'024; size *= 2)
+      {
+        void* r = alloc.ReallocSized(p, size, size * 2, 8);
+        if (!r)
+          break;
+        if (r != p)
+          return false;
+      }
+      alloc.Free(p, 8);
+      return true;
+    });
+    UNIT_TEST_REQUIRE(ok);
+  }
 }
@@ -0,0 +1,91 @@
+#include <Core/Allocator/GlobalAllocator.h>
+#include <Core/Concurrency/MpscRing.h>
+#include <UnitTest/UnitTest.h>
+#include <thread>
+
+UNIT_TEST_SUITE(Concurrency)
+{
+  using Core::MpscRing;
+
+  UNIT_TEST(MpscRing_PushPop_FullAndEmpty)
+  {
+    MpscRing<i32> ring(4);
+    for (i32 i = 0; i < 4; ++i)
+      UNIT_TEST_REQUIRE(ring.TryPush(i));
+    UNIT_TEST_REQUIRE_FALSE(ring.TryPush(4));
+
+    i32 value = -1;
+    for (i32 i = 0; i < 4; ++i)
+    {
+      UNIT_TEST_REQUIRE(ring.TryPop(value));
+      UNIT_TEST_REQUIRE(value == i);
+    }
+    UNIT_TEST_REQUIRE_FALSE(ring.TryPop(value));
+    UNIT_TEST_REQUIRE(ring.TryPush(5));
+  }
+  UNIT_TEST(MpscRing_Batches_ArePartialWhenNearlyFull)
+  {
+    MpscRing<i32> ring(8);
+    i32 const     in[6] = {0, 1, 2, 3, 4, 5};
+    i32           out[8]{};
+
+    UNIT_TEST_REQUIRE(ring.TryPushBatch(Core::Span<i32 const>(in, 6)) == 6);
+    UNIT_TEST_REQUIRE(ring.TryPushBatch(Core::Span<i32 const>(in, 6)) == 2);
+    UNIT_TEST_REQUIRE(ring.TryPopBatch(Core::Span<i32>(out, 8)) == 8);
+    UNIT_TEST_REQUIRE(out[5] == 5 && out[6] == 0 && out[7] == 1);
+  }
+  UNIT_TEST(MpscRing_Stress_NoItemLostOrDuplicated)
+  {
+    constexpr i32 Producers   = 4;
+    constexpr u32 PerProducer = 50'000;
+
+    MpscRing<u64> ring(1024);
+    std::thread   producers[Producers];
+    for (i32 p = 0; p < Producers; ++p)
+    {
+      producers[p] = std::thread([&ring, p]() {
+        Core::GlobalAllocator::ThreadScope allocatorThread;
+        u64                                batch[8];
+        for (u32 i = 0; i < PerProducer;)
+        {
+          // Alternates single and batched pushes, items are tagged with their producer
+          if (i % 16 == 0 && i + 8 <= PerProducer)
+          {
+            for (u32 j = 0; j < 8; ++j)
+              batch[j] = u64(p) << 32 | (i + j);
+            i += u32(ring.TryPushBatch(Core::Span<u64 const>(batch, 8)));
+          }
+          else if (ring.TryPush(u64(p) << 32 | i))
+          {
+            ++i;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    // Items of a given producer shall come out in the order they were pushed
+    u32  next[Producers]{};
+    bool inOrder = true;
+    for (u64 received = 0; received < u64(Producers) * PerProducer;)
+    {
+      u64 item;
+      if (!ring.TryPop(item))
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      u32 const p = u32(item >> 32);
+      inOrder &= p < Producers && u32(item) == next[p]++;
+      ++received;
+    }
+    for (auto& producer : producers)
+      producer.join();
+
+    UNIT_TEST_REQUIRE(inOrder);
+    UNIT_TEST_REQUIRE(ring.IsEmpty());
+  }
+}
@@ -0,0 +1,89 @@
+#include <Core/Allocator/GlobalAllocator.h>
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Concurrency/SpscRing.h>
+#include <Core/Container/String.h>
+#include <UnitTest/UnitTest.h>
+#include <thread>
+
+UNIT_TEST_SUITE(Concurrency)
+{
+  using Core::SpscRing;
+
+  UNIT_TEST(SpscRing_CapacityIsRoundedToPowerOfTwo)
+  {
+    SpscRing<i32> ring(5);
+    UNIT_TEST_REQUIRE(ring.Capacity() == 8);
+    UNIT_TEST_REQUIRE(ring.IsEmpty());
+  }
+  UNIT_TEST(SpscRing_PushPop_FullAndEmpty)
+  {
+    SpscRing<i32> ring(4);
+    for (i32 i = 0; i < 4; ++i)
+      UNIT_TEST_REQUIRE(ring.TryPush(i));
+    UNIT_TEST_REQUIRE_FALSE(ring.TryPush(4));
+    UNIT_TEST_REQUIRE(ring.Size() == 4);
+
+    i32 value = -1;
+    for (i32 i = 0; i < 4; ++i)
+    {
+      UNIT_TEST_REQUIRE(ring.TryPop(value));
+      UNIT_TEST_REQUIRE(value == i);
+    }
+    UNIT_TEST_REQUIRE_FALSE(ring.TryPop(value));
+  }
+  UNIT_TEST(SpscRing_Batches_WrapAround)
+  {
+    SpscRing<i32> ring(8);
+    i32 const     in[6] = {0, 1, 2, 3, 4, 5};
+    i32           out[6]{};
+
+    UNIT_TEST_REQUIRE(ring.TryPushBatch(Core::Span<i32 const>(in, 6)) == 6);
+    UNIT_TEST_REQUIRE(ring.TryPopBatch(Core::Span<i32>(out, 4)) == 4);
+    UNIT_TEST_REQUIRE(ring.TryPushBatch(Core::Span<i32 const>(in, 6)) == 6);
+    UNIT_TEST_REQUIRE(ring.TryPushBatch(Core::Span<i32 const>(in, 6)) == 0);
+    UNIT_TEST_REQUIRE(ring.TryPopBatch(Core::Span<i32>(out, 6)) == 6);
+    UNIT_TEST_REQUIRE(out[0] == 4 && out[1] == 5 && out[2] == 0 && out[5] == 3);
+  }
+  UNIT_TEST(SpscRing_Destructor_ReleasesPendingItems)
+  {
+    Core::TrackingAllocator alloc;
+    {
+      SpscRing<Core::String<char>> ring(4, &alloc);
+      ring.TryEmplace(Core::StringView<char>("a string too long to be stored inline", 37), &alloc);
+      ring.TryEmplace(Core::StringView<char>("short"), &alloc);
+    }
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveCount_ == 0);
+  }
+  UNIT_TEST(SpscRing_Stress_KeepsOrder)
+  {
+    constexpr u64 Count = 200'000;
+
+    SpscRing<u64> ring(256);
+    std::thread   producer([&ring]() {
+      Core::GlobalAllocator::ThreadScope allocatorThread;
+      for (u64 i = 0; i < Count;)
+      {
+        if (ring.TryPush(i))
+          ++i;
+        else
+          std::this_thread::yield();
+      }
+    });
+
+    u64  expected = 0;
+    bool inOrder  = true;
+    while (expected < Count)
+    {
+      u64 batch[32];
+      i32 const popped = ring.TryPopBatch(Core::Span<u64>(batch, 32));
+      if (popped == 0)
+        std::this_thread::yield();
+      for (i32 i = 0; i < popped; ++i)
+        inOrder &= batch[i] == expected++;
+    }
+    producer.join();
+
+    UNIT_TEST_REQUIRE(inOrder);
+    UNIT_TEST_REQUIRE(ring.IsEmpty());
+  }
+}
@@ -0,0 +1,101 @@
+#include <Core/Container/BitSet.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using Core::BitSet;
+  using Core::DynamicBitSet;
+
+  UNIT_TEST(BitSet_SetTestResetCount)
+  {
+    BitSet<200> bits;
+    UNIT_TEST_REQUIRE(bits.None());
+    bits.Set(0);
+    bits.Set(63);
+    bits.Set(64);
+    bits.Set(199);
+    UNIT_TEST_REQUIRE(bits.Test(63));
+    UNIT_TEST_REQUIRE(bits.Test(64));
+    UNIT_TEST_REQUIRE_FALSE(bits.Test(65));
+    UNIT_TEST_REQUIRE(bits.Count() == 4);
+
+    bits.Reset(63);
+    bits.Flip(1);
+    UNIT_TEST_REQUIRE_FALSE(bits.Test(63));
+    UNIT_TEST_REQUIRE(bits.Test(1));
+    UNIT_TEST_REQUIRE(bits.Count() == 4);
+
+    bits.SetAll();
+    UNIT_TEST_REQUIRE(bits.Count() == 200);
+    bits.Reset();
+    UNIT_TEST_REQUIRE(bits.None());
+  }
+  UNIT_TEST(BitSet_FindNextSet)
+  {
+    BitSet<300> bits;
+    UNIT_TEST_REQUIRE(bits.FindFirstSet() == -1);
+
+    bits.Set(5);
+    bits.Set(130);
+    bits.Set(299);
+    UNIT_TEST_REQUIRE(bits.FindFirstSet() == 5);
+    UNIT_TEST_REQUIRE(bits.FindNextSet(5) == 5);
+    UNIT_TEST_REQUIRE(bits.FindNextSet(6) == 130);
+    UNIT_TEST_REQUIRE(bits.FindNextSet(131) == 299);
+    UNIT_TEST_REQUIRE(bits.FindNextSet(300) == -1);
+
+    i32 visited = 0;
+    for (i32 bit = bits.FindFirstSet(); bit != -1; bit = bits.FindNextSet(bit + 1))
+      ++visited;
+    UNIT_TEST_REQUIRE(visited == 3);
+  }
+  UNIT_TEST(BitSet_WordOperations)
+  {
+    // 512 bits, so the 4-word paths and the scalar tail both run
+    BitSet<520> a;
+    BitSet<520> b;
+    for (i32 i = 0; i < 520; i += 3)
+      a.Set(i);
+    for (i32 i = 0; i < 520; i += 6)
+      b.Set(i);
+
+    UNIT_TEST_REQUIRE(a.ContainsAll(b));
+    UNIT_TEST_REQUIRE_FALSE(b.ContainsAll(a));
+    UNIT_TEST_REQUIRE(a.Intersects(b));
+    UNIT_TEST_REQUIRE((a & b) == b);
+    UNIT_TEST_REQUIRE((a | b) == a);
+
+    BitSet<520> rest = a;
+    rest.AndNot(b);
+    UNIT_TEST_REQUIRE(rest.Count() == a.Count() - b.Count());
+    UNIT_TEST_REQUIRE_FALSE(rest.Intersects(b));
+
+    b.Set(517);
+    UNIT_TEST_REQUIRE_FALSE(a.ContainsAll(b));
+  }
+  UNIT_TEST(DynamicBitSet_ResizeAndOperations)
+  {
+    DynamicBitSet a(70);
+    a.SetAll();
+    UNIT_TEST_REQUIRE(a.Count() == 70);
+
+    a.Resize(65);
+    UNIT_TEST_REQUIRE(a.Count() == 65);
+    a.Resize(300);
+    UNIT_TEST_REQUIRE(a.Count() == 65);
+    UNIT_TEST_REQUIRE_FALSE(a.Test(70));
+
+    DynamicBitSet b(300);
+    b.Set(3);
+    b.Set(250);
+    UNIT_TEST_REQUIRE_FALSE(a.ContainsAll(b));
+    a |= b;
+    UNIT_TEST_REQUIRE(a.ContainsAll(b));
+    UNIT_TEST_REQUIRE(a.FindNextSet(65) == 250);
+
+    a &= b;
+    UNIT_TEST_REQUIRE(a == b);
+    a.AndNot(b);
+    UNIT_TEST_REQUIRE(a.None());
+  }
+}
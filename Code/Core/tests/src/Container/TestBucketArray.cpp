@@ -0,0 +1,160 @@
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Container/BucketArray.h>
+#include <Core/Container/String.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using Core::BucketArray;
+
+  UNIT_TEST(BucketArray_PointersStayStable)
+  {
+    BucketArray<i32, 4> array;
+    Core::Vector<i32*>  pointers;
+    for (i32 i = 0; i < 20; ++i)
+      pointers.EmplaceBack(array.Emplace(i));
+
+    UNIT_TEST_REQUIRE(array.Size() == 20);
+    UNIT_TEST_REQUIRE(array.BucketCount() == 5);
+    for (i32 i = 0; i < 20; ++i)
+      UNIT_TEST_REQUIRE(*pointers[i] == i);
+
+    i32 expected = 0;
+    for (i32 const value : array)
+      UNIT_TEST_REQUIRE(value == expected++);
+    UNIT_TEST_REQUIRE(expected == 20);
+  }
+  UNIT_TEST(BucketArray_IterationSkipsErasedSlots)
+  {
+    BucketArray<i32, 8> array;
+    Core::Vector<i32*>  pointers;
+    for (i32 i = 0; i < 16; ++i)
+      pointers.EmplaceBack(array.Emplace(i));
+
+    // Single holes, a merged block on both sides, and a run reaching the end of a bucket
+    for (i32 const i : {0, 2, 4, 3, 6, 7, 13})
+      array.Erase(pointers[i]);
+    UNIT_TEST_REQUIRE(array.Size() == 9);
+
+    Core::Vector<i32> seen;
+    for (i32 const value : array)
+      seen.EmplaceBack(value);
+    UNIT_TEST_REQUIRE(seen.Size() == 9);
+    i32 const expected[] = {1, 5, 8, 9, 10, 11, 12, 14, 15};
+    for (i32 i = 0; i < 9; ++i)
+      UNIT_TEST_REQUIRE(seen[i] == expected[i]);
+  }
+  UNIT_TEST(BucketArray_ReusesErasedSlotsBeforeGrowing)
+  {
+    BucketArray<i32, 8> array;
+    Core::Vector<i32*>  pointers;
+    for (i32 i = 0; i < 8; ++i)
+      pointers.EmplaceBack(array.Emplace(i));
+
+    array.Erase(pointers[2]);
+    array.Erase(pointers[3]);
+    array.Erase(pointers[6]);
+    UNIT_TEST_REQUIRE(array.Emplace(100) != nullptr);
+    UNIT_TEST_REQUIRE(array.Emplace(101) != nullptr);
+    UNIT_TEST_REQUIRE(array.Emplace(102) != nullptr);
+    UNIT_TEST_REQUIRE(array.BucketCount() == 1);
+    UNIT_TEST_REQUIRE(array.Size() == 8);
+
+    array.Emplace(103);
+    UNIT_TEST_REQUIRE(array.BucketCount() == 2);
+
+    i32 sum = 0;
+    for (i32 const value : array)
+      sum += value;
+    UNIT_TEST_REQUIRE(sum == 0 + 1 + 4 + 5 + 7 + 100 + 101 + 102 + 103);
+  }
+  UNIT_TEST(BucketArray_EraseWhileIterating)
+  {
+    BucketArray<i32, 4> array;
+    for (i32 i = 0; i < 30; ++i)
+      array.Emplace(i);
+
+    for (auto it = array.begin(); it != array.end();)
+      it = *it % 3 == 0 ? array.Erase(it) : ++it;
+    UNIT_TEST_REQUIRE(array.Size() == 20);
+
+    for (i32 const value : array)
+      UNIT_TEST_REQUIRE(value % 3 != 0);
+  }
+  UNIT_TEST(BucketArray_ReleasesEmptyBuckets)
+  {
+    Core::TrackingAllocator alloc;
+    {
+      BucketArray<Core::String<char>, 4> array(&alloc);
+      Core::Vector<Core::String<char>*>  pointers;
+      for (i32 i = 0; i < 12; ++i)
+        pointers.EmplaceBack(array.Emplace("a string long enough to live on the heap"));
+
+      for (i32 i = 4; i < 8; ++i)
+        array.Erase(pointers[i]);
+      UNIT_TEST_REQUIRE(array.BucketCount() == 2);
+      UNIT_TEST_REQUIRE(array.Size() == 8);
+
+      i32 count = 0;
+      for (auto const& s : array)
+        count += s == "a string long enough to live on the heap" ? 1 : 0;
+      UNIT_TEST_REQUIRE(count == 8);
+    }
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveCount_ == 0);
+  }
+  UNIT_TEST(BucketArray_KeepsASpareBucket)
+  {
+    Core::TrackingAllocator alloc;
+    {
+      // A single element spawned and destroyed, then one more past a full bucket
+      BucketArray<i32, 4> array(&alloc);
+      for (i32 i = 0; i < 100; ++i)
+        array.Erase(array.Emplace(i));
+      UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 1);
+      UNIT_TEST_REQUIRE(array.BucketCount() == 0);
+
+      for (i32 i = 0; i < 4; ++i)
+        array.Emplace(i);
+      for (i32 i = 0; i < 100; ++i)
+        array.Erase(array.Emplace(i));
+      UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 2);
+      UNIT_TEST_REQUIRE(array.BucketCount() == 1);
+      UNIT_TEST_REQUIRE(array.Size() == 4);
+    }
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveCount_ == 0);
+  }
+  UNIT_TEST(BucketArray_Churn)
+  {
+    BucketArray<i32, 16> array;
+    Core::Vector<i32*>   live;
+    u32                  seed = 12'345;
+    for (i32 step = 0; step < 20'000; ++step)
+    {
+      seed = seed * 1'664'525u + 1'013'904'223u;
+      if (live.IsEmpty() || (seed >> 16) % 3 != 0)
+        live.EmplaceBack(array.Emplace(step));
+      else
+      {
+        i32 const index = i32((seed >> 8) % u32(live.Size()));
+        array.Erase(live[index]);
+        live[index] = live.Back();
+        live.PopBack();
+      }
+    }
+    UNIT_TEST_REQUIRE(array.Size() == live.Size());
+
+    i64 expectedSum = 0;
+    for (i32 const* p : live)
+      expectedSum += *p;
+    i64 sum   = 0;
+    i32 count = 0;
+    for (i32 const value : array)
+    {
+      sum += value;
+      ++count;
+    }
+    UNIT_TEST_REQUIRE(count == live.Size());
+    UNIT_TEST_REQUIRE(sum == expectedSum);
+  }
+}
@@ -0,0 +1,161 @@
+#include <Core/Container/FlatMap.h>
+#include <Core/Container/InlineVector.h>
+#include <Core/Container/String.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  struct Item
+  {
+    u64 Key_;
+    i32 Value_;
+  };
+
+  Core::Vector<Item> ShuffledItems(i32 const count, u64 const stride)
+  {
+    Core::Vector<Item> items;
+    for (i32 i = 0; i < count; ++i)
+    {
+      // 7 is coprime with the count used by the tests, so this visits every key once
+      i32 const k = (i * 7) % count;
+      items.EmplaceBack(Item{u64(k) * stride, k});
+    }
+    return items;
+  }
+
+  template <typename Map>
+  bool IsSortedWithValues(Map const& map, i32 const expectedSize, u64 const stride)
+  {
+    i32 count = 0;
+    u64 prev  = 0;
+    for (auto const& kv : map)
+    {
+      if ((count > 0 && !(prev < kv.Key_)) || kv.Key_ % stride != 0 || u64(kv.Value_) != kv.Key_ / stride)
+        return false;
+      prev = kv.Key_;
+      ++count;
+    }
+    return count == expectedSize;
+  }
+
+  UNIT_TEST(FlatMap_BuildFrom_SortsAndKeepsFirstDuplicate)
+  {
+    Core::Vector<Item> items = ShuffledItems(100, 3);
+    items.EmplaceBack(Item{3, -1});
+
+    Core::FlatMap<u64, i32> map;
+    map.TryEmplace(1'000'000ull, 0);
+    map.BuildFrom(items.begin(), items.end());
+    UNIT_TEST_REQUIRE(map.Size() == 100);
+    UNIT_TEST_REQUIRE(IsSortedWithValues(map, 100, 3));
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(1'000'000ull));
+    UNIT_TEST_REQUIRE(*map.Find(3ull) == 1);
+  }
+  UNIT_TEST(FlatMap_Insert_MergesAndSkipsExistingKeys)
+  {
+    Core::Vector<Item> const evens = ShuffledItems(100, 2);
+    Core::Vector<Item> const all   = ShuffledItems(100, 1);
+
+    Core::FlatMap<u64, i32> map;
+    UNIT_TEST_REQUIRE(map.Insert(evens.begin(), evens.end()) == 100);
+    UNIT_TEST_REQUIRE(IsSortedWithValues(map, 100, 2));
+
+    // Keys 0, 2 ... 98 already exist with another value, only the odd ones go in
+    UNIT_TEST_REQUIRE(map.Insert(all.begin(), all.end()) == 50);
+    UNIT_TEST_REQUIRE(map.Size() == 150);
+    UNIT_TEST_REQUIRE(*map.Find(98ull) == 49);
+    UNIT_TEST_REQUIRE(*map.Find(99ull) == 99);
+    UNIT_TEST_REQUIRE(*map.Find(198ull) == 99);
+
+    u64 prev = 0;
+    for (auto const& kv : map)
+    {
+      UNIT_TEST_REQUIRE(kv.Key_ == 0 || prev < kv.Key_);
+      prev = kv.Key_;
+    }
+  }
+  UNIT_TEST(FlatMap_Insert_NonTrivialValues)
+  {
+    struct Named
+    {
+      i32         Key_;
+      char const* Value_;
+    };
+    Named const first[]  = {{5, "five"}, {1, "one, long enough to be on the heap"}};
+    Named const second[] = {{3, "three"}, {7, "seven"}, {0, "zero"}, {5, "not five"}};
+
+    Core::FlatMap<i32, Core::String<char>> map;
+    map.Insert(first, first + 2);
+    UNIT_TEST_REQUIRE(map.Insert(second, second + 4) == 3);
+    UNIT_TEST_REQUIRE(map.Keys()[0] == 0);
+    UNIT_TEST_REQUIRE(map.Keys()[4] == 7);
+    UNIT_TEST_REQUIRE(*map.Find(1) == "one, long enough to be on the heap");
+    UNIT_TEST_REQUIRE(*map.Find(5) == "five");
+  }
+  UNIT_TEST(CompactFlatMap_BuildFromAndInsert)
+  {
+    Core::Vector<Item> const evens = ShuffledItems(100, 2);
+    Core::Vector<Item> const all   = ShuffledItems(100, 1);
+
+    Core::CompactFlatMap<u64, i32> map;
+    map.BuildFrom(evens.begin(), evens.end());
+    UNIT_TEST_REQUIRE(IsSortedWithValues(map, 100, 2));
+    UNIT_TEST_REQUIRE(map.Insert(all.begin(), all.end()) == 50);
+    UNIT_TEST_REQUIRE(map.Size() == 150);
+    UNIT_TEST_REQUIRE(*map.Find(99ull) == 99);
+
+    Core::CompactFlatMap<u64, i32, Core::InlineStorage<4>::Type> small;
+    Item const                                                   items[] = {{9, 1}, {2, 2}, {9, 3}};
+    small.Insert(items, items + 3);
+    UNIT_TEST_REQUIRE(small.Size() == 2);
+    UNIT_TEST_REQUIRE(*small.Find(9ull) == 1);
+  }
+  UNIT_TEST(FlatMap_Find_SmallMapsOfSignedAndUnsignedKeys)
+  {
+    // Below the linear scan limit, with values on both sides of the sign bit
+    Core::FlatMap<i64, i32> signedMap;
+    Core::FlatMap<u32, i32> unsignedMap;
+    for (i32 i = 0; i < 13; ++i)
+    {
+      signedMap.TryEmplace(i64(i - 6) * 1'000'000'000'000ll, i);
+      unsignedMap.TryEmplace(u32(i) * 0x1500'0000u, i);
+    }
+
+    for (i32 i = 0; i < 13; ++i)
+    {
+      UNIT_TEST_REQUIRE(*signedMap.Find(i64(i - 6) * 1'000'000'000'000ll) == i);
+      UNIT_TEST_REQUIRE(*unsignedMap.Find(u32(i) * 0x1500'0000u) == i);
+      UNIT_TEST_REQUIRE_FALSE(signedMap.Contains(i64(i - 6) * 1'000'000'000'000ll + 1));
+      UNIT_TEST_REQUIRE_FALSE(unsignedMap.Contains(u32(i) * 0x1500'0000u + 1));
+    }
+    UNIT_TEST_REQUIRE_FALSE(signedMap.Contains(i64(-7'000'000'000'000ll)));
+    UNIT_TEST_REQUIRE_FALSE(unsignedMap.Contains(0xFFFF'FFFFu));
+  }
+  UNIT_TEST(FlatMap_SearchIndex)
+  {
+    Core::FlatMap<u64, i32> map;
+    for (i32 i = 0; i < 1'000; ++i)
+      map.TryEmplace(u64(i) * 2 + 1, i);
+
+    map.BuildSearchIndex();
+    UNIT_TEST_REQUIRE(map.HasSearchIndex());
+    for (i32 i = 0; i < 1'000; ++i)
+    {
+      UNIT_TEST_REQUIRE(*map.Find(u64(i) * 2 + 1) == i);
+      UNIT_TEST_REQUIRE_FALSE(map.Contains(u64(i) * 2));
+    }
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(2'001ull));
+
+    // Any modification drops the index, lookups keep working through the binary search
+    map.TryEmplace(4ull, -1);
+    UNIT_TEST_REQUIRE_FALSE(map.HasSearchIndex());
+    UNIT_TEST_REQUIRE(*map.Find(4ull) == -1);
+    UNIT_TEST_REQUIRE(*map.Find(5ull) == 2);
+
+    Core::FlatMap<u64, i32> small;
+    small.TryEmplace(1ull, 1);
+    small.BuildSearchIndex();
+    UNIT_TEST_REQUIRE_FALSE(small.HasSearchIndex());
+  }
+}
@@ -0,0 +1,137 @@
+#include <Core/Allocator/StackAllocator.h>
+#include <Core/Container/HashMap.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using IntMap = Core::HashMap<u64, i32>;
+
+  UNIT_TEST(HashMap_DefaultCtor_IsEmpty)
+  {
+    IntMap map;
+    UNIT_TEST_REQUIRE(map.IsEmpty());
+    UNIT_TEST_REQUIRE(map.Capacity() == 0);
+    UNIT_TEST_REQUIRE_FALSE(map.Find(0));
+    UNIT_TEST_REQUIRE(map.begin() == map.end());
+  }
+  UNIT_TEST(HashMap_TryEmplace_FindsEveryKey)
+  {
+    IntMap map;
+    for (i32 i = 0; i < 10'000; ++i)
+      UNIT_TEST_REQUIRE(map.TryEmplace(u64(i) * 7, i));
+    UNIT_TEST_REQUIRE(map.Size() == 10'000);
+
+    for (i32 i = 0; i < 10'000; ++i)
+    {
+      i32 const* value = map.Find(u64(i) * 7);
+      UNIT_TEST_REQUIRE(value && *value == i);
+      UNIT_TEST_REQUIRE_FALSE(map.Contains(u64(i) * 7 + 1));
+    }
+  }
+  UNIT_TEST(HashMap_TryEmplace_FailsOnExistingKey)
+  {
+    IntMap map;
+    UNIT_TEST_REQUIRE(map.TryEmplace(42, 1));
+    UNIT_TEST_REQUIRE_FALSE(map.TryEmplace(42, 2));
+    UNIT_TEST_REQUIRE(*map.Find(42) == 1);
+    UNIT_TEST_REQUIRE(map.Size() == 1);
+  }
+  UNIT_TEST(HashMap_TryRemove_KeepsOtherKeys)
+  {
+    IntMap map;
+    for (i32 i = 0; i < 1'000; ++i)
+      map.TryEmplace(u64(i), i);
+    for (i32 i = 0; i < 1'000; i += 2)
+      UNIT_TEST_REQUIRE(map.TryRemove(u64(i)));
+    UNIT_TEST_REQUIRE_FALSE(map.TryRemove(0));
+    UNIT_TEST_REQUIRE(map.Size() == 500);
+
+    for (i32 i = 0; i < 1'000; ++i)
+      UNIT_TEST_REQUIRE(map.Contains(u64(i)) == (i % 2 == 1));
+  }
+  UNIT_TEST(HashMap_TryRemove_ChurnDoesntGrowTheTable)
+  {
+    IntMap map;
+    for (i32 i = 0; i < 100; ++i)
+      map.TryEmplace(u64(i), i);
+    i32 const capacity = map.Capacity();
+
+    for (i32 i = 100; i < 100'000; ++i)
+    {
+      UNIT_TEST_REQUIRE(map.TryRemove(u64(i - 100)));
+      UNIT_TEST_REQUIRE(map.TryEmplace(u64(i), i));
+    }
+    UNIT_TEST_REQUIRE(map.Size() == 100);
+    UNIT_TEST_REQUIRE(map.Capacity() <= 2 * capacity);
+    for (i32 i = 99'900; i < 100'000; ++i)
+      UNIT_TEST_REQUIRE(*map.Find(u64(i)) == i);
+  }
+  UNIT_TEST(HashMap_Reserve_KeepsPointersStable)
+  {
+    IntMap map;
+    map.Reserve(1'000);
+    i32* const first = map.TryEmplace(0, 0);
+    for (i32 i = 1; i < 1'000; ++i)
+      map.TryEmplace(u64(i), i);
+    UNIT_TEST_REQUIRE(map.Find(0) == first);
+  }
+  UNIT_TEST(HashMap_Iteration_VisitsEveryItemOnce)
+  {
+    IntMap map;
+    for (i32 i = 0; i < 100; ++i)
+      map.TryEmplace(u64(i), i);
+
+    i64 keySum = 0;
+    i32 count  = 0;
+    for (auto&& [key, value] : map)
+    {
+      UNIT_TEST_REQUIRE(key == u64(value));
+      keySum += (i64)key;
+      ++count;
+    }
+    UNIT_TEST_REQUIRE(count == 100);
+    UNIT_TEST_REQUIRE(keySum == 99 * 100 / 2);
+
+    i64 valueSum = 0;
+    for (i32 const value : map.Values())
+      valueSum += value;
+    UNIT_TEST_REQUIRE(valueSum == 99 * 100 / 2);
+  }
+  UNIT_TEST(HashMap_NonTrivialValue_CopyAndMove)
+  {
+    Core::HashMap<u64, Core::Vector<i32>> map;
+    for (i32 i = 0; i < 100; ++i)
+      map.TryEmplace(u64(i), i, i);
+
+    auto copy = map;
+    UNIT_TEST_REQUIRE(copy.Size() == 100);
+    UNIT_TEST_REQUIRE(copy.Find(50)->Size() == 50);
+    UNIT_TEST_REQUIRE(copy.Find(50)->Data() != map.Find(50)->Data());
+
+    auto moved = std::move(map);
+    UNIT_TEST_REQUIRE(map.IsEmpty());
+    UNIT_TEST_REQUIRE(moved.Size() == 100);
+    UNIT_TEST_REQUIRE((*moved.Find(99))[98] == 99);
+  }
+  UNIT_TEST(HashMap_Clear_KeepsCapacity)
+  {
+    IntMap map;
+    for (i32 i = 0; i < 100; ++i)
+      map.TryEmplace(u64(i), i);
+    i32 const capacity = map.Capacity();
+    map.Clear();
+    UNIT_TEST_REQUIRE(map.IsEmpty());
+    UNIT_TEST_REQUIRE(map.Capacity() == capacity);
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(0));
+  }
+  UNIT_TEST(HashMap_CustomAllocator_IsUsed)
+  {
+    Core::StackAllocator alloc(64 * 1'024);
+    IntMap               map(&alloc);
+    for (i32 i = 0; i < 100; ++i)
+      map.TryEmplace(u64(i), i);
+    UNIT_TEST_REQUIRE(map.Allocator() == &alloc);
+    UNIT_TEST_REQUIRE(alloc.Used() > 0);
+  }
+}
@@ -0,0 +1,83 @@
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Container/FlatMap.h>
+#include <Core/Container/InlineVector.h>
+#include <Core/Container/String.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using Core::InlineVector;
+
+  UNIT_TEST(InlineVector_DefaultCtor_HasInlineCapacity)
+  {
+    Core::TrackingAllocator alloc;
+    InlineVector<i32, 4>    v(&alloc);
+    UNIT_TEST_REQUIRE(v.IsEmpty());
+    UNIT_TEST_REQUIRE(v.Capacity() == 4);
+    UNIT_TEST_REQUIRE(v.IsInline());
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 0);
+  }
+  UNIT_TEST(InlineVector_EmplaceBack_StaysInlineUpToN)
+  {
+    Core::TrackingAllocator alloc;
+    InlineVector<i32, 4>    v(&alloc);
+    for (i32 i = 0; i < 4; ++i)
+      v.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(v.IsInline());
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 0);
+
+    v.EmplaceBack(4);
+    UNIT_TEST_REQUIRE_FALSE(v.IsInline());
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 1);
+    for (i32 i = 0; i < v.Size(); ++i)
+      UNIT_TEST_REQUIRE(v[i] == i);
+  }
+  UNIT_TEST(InlineVector_EraseAndFind)
+  {
+    InlineVector<i32, 4> v{0, 1, 2, 3};
+    v.Erase(1);
+    UNIT_TEST_REQUIRE(v.Size() == 3);
+    UNIT_TEST_REQUIRE(v.Find(2) == v.Data() + 1);
+    v.EraseIf([](i32 const i) { return i % 2 == 0; });
+    UNIT_TEST_REQUIRE(v.Size() == 1);
+    UNIT_TEST_REQUIRE(v[0] == 3);
+  }
+  UNIT_TEST(InlineVector_Copy_KeepsItsOwnBuffer)
+  {
+    InlineVector<i32, 4> v0{0, 1, 2};
+    InlineVector<i32, 4> v1(v0);
+    UNIT_TEST_REQUIRE(v1.IsInline());
+    UNIT_TEST_REQUIRE(v1.Data() != v0.Data());
+    UNIT_TEST_REQUIRE(v1.Size() == 3 && v1[2] == 2);
+  }
+  UNIT_TEST(InlineVector_Move_NonTrivialType)
+  {
+    using StringVector = InlineVector<Core::String<char>, 2>;
+    StringVector v0;
+    v0.EmplaceBack("first");
+    v0.EmplaceBack("second");
+    v0.EmplaceBack("third, spilled");
+
+    StringVector v1(std::move(v0));
+    UNIT_TEST_REQUIRE(v0.IsEmpty());
+    UNIT_TEST_REQUIRE(v1.Size() == 3);
+    UNIT_TEST_REQUIRE(v1[2] == "third, spilled");
+
+    StringVector v2;
+    v2 = std::move(v1);
+    UNIT_TEST_REQUIRE(v2.Size() == 3);
+    UNIT_TEST_REQUIRE(v2[0] == "first");
+  }
+  UNIT_TEST(InlineVector_CompactFlatMapStorage_DoesntAllocate)
+  {
+    Core::TrackingAllocator                                            alloc;
+    Core::CompactFlatMap<u64, i32, Core::InlineStorage<4>::Type> map(&alloc);
+    map.TryEmplace(3, 3);
+    map.TryEmplace(1, 1);
+    map.TryEmplace(2, 2);
+    UNIT_TEST_REQUIRE(*map.Find(2) == 2);
+    UNIT_TEST_REQUIRE(map.TryRemove(1));
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(1));
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 0);
+  }
+}
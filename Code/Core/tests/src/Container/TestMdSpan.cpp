@@ -0,0 +1,79 @@
+#include <Core/Container/MdSpan.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Span)
+{
+  using Core::MdSpan;
+
+  UNIT_TEST(MdSpan_RowMajor_IndexingAndSlices)
+  {
+    Core::Vector<i32> items(4 * 5 * 6);
+    for (i32 i = 0; i < items.Size(); ++i)
+      items[i] = i;
+
+    MdSpan<i32, 3> grid(items.Data(), 4, 5, 6);
+    UNIT_TEST_REQUIRE(grid.Size() == 120);
+    UNIT_TEST_REQUIRE(grid.IsContiguous());
+    UNIT_TEST_REQUIRE(grid(2, 3, 4) == 2 * 30 + 3 * 6 + 4);
+
+    MdSpan<i32, 2> plane = grid.Slice(1);
+    UNIT_TEST_REQUIRE(plane.Extent(0) == 5);
+    UNIT_TEST_REQUIRE(plane(4, 5) == 30 + 4 * 6 + 5);
+    UNIT_TEST_REQUIRE(plane.Row(2)[1] == 30 + 12 + 1);
+    UNIT_TEST_REQUIRE(plane.Row(2).IsContiguous());
+
+    Core::StridedSpan<i32> column = plane.Column(3);
+    UNIT_TEST_REQUIRE(column.Size() == 5);
+    UNIT_TEST_REQUIRE(column[4] == 30 + 24 + 3);
+
+    MdSpan<i32, 2> window = plane.SubView({1, 2}, {3, 2});
+    UNIT_TEST_REQUIRE_FALSE(window.IsContiguous());
+    UNIT_TEST_REQUIRE(window(0, 0) == 30 + 6 + 2);
+    UNIT_TEST_REQUIRE(window(2, 1) == 30 + 18 + 3);
+
+    i32 sum = 0;
+    window.ForEach([&sum](i32 const item) { sum += item; });
+    UNIT_TEST_REQUIRE(sum == (38 + 39) + (44 + 45) + (50 + 51));
+  }
+  UNIT_TEST(MdSpan_Tiled)
+  {
+    using TiledGrid = MdSpan<i32, 2, Core::LayoutTiled<4>>;
+
+    // 10 x 6 rounds up to 3 x 2 tiles of 4 x 4
+    TiledGrid::MappingType const mapping({10, 6});
+    UNIT_TEST_REQUIRE(mapping.StorageSize() == 3 * 2 * 16);
+
+    Core::Vector<i32> storage(i32(mapping.StorageSize()), -1);
+    TiledGrid         grid(storage.Data(), mapping);
+    UNIT_TEST_REQUIRE(grid.TileCount(0) == 3);
+    UNIT_TEST_REQUIRE(grid.TileCount(1) == 2);
+
+    for (i32 y = 0; y < 10; ++y)
+      for (i32 x = 0; x < 6; ++x)
+        grid(y, x) = y * 100 + x;
+
+    // A tile is packed, the next row of tiles starts after TileCount(1) tiles
+    UNIT_TEST_REQUIRE(storage[0] == 0);
+    UNIT_TEST_REQUIRE(storage[5] == 101);
+    UNIT_TEST_REQUIRE(storage[16] == 4);
+    UNIT_TEST_REQUIRE(storage[32] == 400);
+
+    MdSpan<i32, 2> edge = grid.Tile(2, 1);
+    UNIT_TEST_REQUIRE(edge.Extent(0) == 2);
+    UNIT_TEST_REQUIRE(edge.Extent(1) == 2);
+    UNIT_TEST_REQUIRE(edge(1, 1) == 905);
+
+    // Visits the used items only, the padding stays untouched
+    i32 visited = 0;
+    grid.ForEach([&visited](i32& item) {
+      ++visited;
+      item = 0;
+    });
+    UNIT_TEST_REQUIRE(visited == 60);
+    i32 padding = 0;
+    for (i32 const item : storage)
+      padding += item == -1 ? 1 : 0;
+    UNIT_TEST_REQUIRE(padding == 96 - 60);
+  }
+}
@@ -0,0 +1,77 @@
+#include <Core/Container/SlotMap.h>
+#include <Core/Container/String.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using Core::SlotMap;
+  using Core::SlotMapHandle;
+
+  UNIT_TEST(SlotMap_NullHandleIsNeverValid)
+  {
+    SlotMap<i32> map;
+    map.Insert(1);
+    UNIT_TEST_REQUIRE(SlotMapHandle{}.IsNull());
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(SlotMapHandle{}));
+    UNIT_TEST_REQUIRE(map.Find(SlotMapHandle{}) == nullptr);
+  }
+  UNIT_TEST(SlotMap_InsertFindErase)
+  {
+    SlotMap<i32>        map;
+    SlotMapHandle const a = map.Insert(10);
+    SlotMapHandle const b = map.Insert(20);
+    SlotMapHandle const c = map.Insert(30);
+    UNIT_TEST_REQUIRE(map.Size() == 3);
+    UNIT_TEST_REQUIRE(*map.Find(b) == 20);
+
+    UNIT_TEST_REQUIRE(map.Erase(a));
+    UNIT_TEST_REQUIRE_FALSE(map.Erase(a));
+    UNIT_TEST_REQUIRE(map.Size() == 2);
+    UNIT_TEST_REQUIRE(map.Find(a) == nullptr);
+    UNIT_TEST_REQUIRE(*map.Find(b) == 20);
+    UNIT_TEST_REQUIRE(*map.Find(c) == 30);
+  }
+  UNIT_TEST(SlotMap_ReusedSlot_InvalidatesStaleHandles)
+  {
+    SlotMap<i32>        map;
+    SlotMapHandle const stale = map.Insert(1);
+    map.Erase(stale);
+
+    SlotMapHandle const fresh = map.Insert(2);
+    UNIT_TEST_REQUIRE(fresh.Index_ == stale.Index_);
+    UNIT_TEST_REQUIRE(fresh != stale);
+    UNIT_TEST_REQUIRE(map.Find(stale) == nullptr);
+    UNIT_TEST_REQUIRE(*map.Find(fresh) == 2);
+    UNIT_TEST_REQUIRE(SlotMapHandle::FromU64(fresh.ToU64()) == fresh);
+  }
+  UNIT_TEST(SlotMap_IterationIsDenseAndHandlesMatch)
+  {
+    SlotMap<i32>  map;
+    SlotMapHandle handles[8];
+    for (i32 i = 0; i < 8; ++i)
+      handles[i] = map.Insert(i);
+    for (i32 i = 0; i < 8; i += 2)
+      map.Erase(handles[i]);
+
+    i32 sum = 0;
+    for (i32 const value : map)
+      sum += value;
+    UNIT_TEST_REQUIRE(sum == 1 + 3 + 5 + 7);
+
+    for (i32 i = 0; i < map.Size(); ++i)
+      UNIT_TEST_REQUIRE(map.Find(map.HandleAt(i)) == map.Data() + i);
+  }
+  UNIT_TEST(SlotMap_Clear_StalesEveryHandle)
+  {
+    SlotMap<Core::String<char>> map;
+    SlotMapHandle const         a = map.Insert(Core::String<char>("a string which doesn't fit inline"));
+    SlotMapHandle const         b = map.Emplace("b");
+    map.Clear();
+    UNIT_TEST_REQUIRE(map.IsEmpty());
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(a));
+    UNIT_TEST_REQUIRE_FALSE(map.Contains(b));
+
+    SlotMapHandle const c = map.Emplace("c");
+    UNIT_TEST_REQUIRE(*map.Find(c) == "c");
+  }
+}
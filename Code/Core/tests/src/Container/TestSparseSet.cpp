@@ -0,0 +1,85 @@
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Container/SparseSet.h>
+#include <Core/Container/String.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Container)
+{
+  using Core::SparseSet;
+
+  UNIT_TEST(SparseSet_TryEmplaceFindContains)
+  {
+    SparseSet<i32> set;
+    UNIT_TEST_REQUIRE(*set.TryEmplace(7, 70) == 70);
+    UNIT_TEST_REQUIRE(*set.TryEmplace(100'000, 1) == 1);
+    UNIT_TEST_REQUIRE(set.TryEmplace(7, 71) == nullptr);
+    UNIT_TEST_REQUIRE(set.Size() == 2);
+    UNIT_TEST_REQUIRE(set.Contains(7));
+    UNIT_TEST_REQUIRE_FALSE(set.Contains(8));
+    UNIT_TEST_REQUIRE_FALSE(set.Contains(5'000'000));
+    UNIT_TEST_REQUIRE(*set.Find(7) == 70);
+  }
+  UNIT_TEST(SparseSet_TryRemove_KeepsTheDenseArrayPacked)
+  {
+    SparseSet<i32> set;
+    for (u32 i = 0; i < 10; ++i)
+      set.TryEmplace(i * 3, i32(i));
+
+    UNIT_TEST_REQUIRE(set.TryRemove(0));
+    UNIT_TEST_REQUIRE(set.TryRemove(12));
+    UNIT_TEST_REQUIRE_FALSE(set.TryRemove(12));
+    UNIT_TEST_REQUIRE(set.Size() == 8);
+
+    i32 sum = 0;
+    for (i32 const value : set)
+      sum += value;
+    UNIT_TEST_REQUIRE(sum == 45 - 0 - 4);
+
+    for (i32 i = 0; i < set.Size(); ++i)
+      UNIT_TEST_REQUIRE(set.Find(set.Keys()[i]) == set.Data() + i);
+  }
+  UNIT_TEST(SparseSet_PagesUseTheSetAllocator)
+  {
+    Core::TrackingAllocator tracking;
+    {
+      SparseSet<i32, 10> set(&tracking);
+      set.TryEmplace(5'000, 1);
+      set.TryEmplace(100'000, 2);
+
+      // Two pages of 1024 dense indices, plus the page table and the dense arrays
+      UNIT_TEST_REQUIRE(tracking.GetTotalStats().LiveBytes_ >= 2 * 1'024 * (i64)sizeof(u32));
+    }
+    UNIT_TEST_REQUIRE(tracking.GetTotalStats().LiveBytes_ == 0);
+  }
+  UNIT_TEST(SparseSet_ClearAndReuse)
+  {
+    SparseSet<Core::String<char>> set;
+    set.TryEmplace(3, "three");
+    set.TryEmplace(2'000, "two thousand, which spills out of the inline buffer");
+    set.Clear();
+    UNIT_TEST_REQUIRE(set.IsEmpty());
+    UNIT_TEST_REQUIRE_FALSE(set.Contains(3));
+
+    set.TryEmplace(2'000, "again");
+    UNIT_TEST_REQUIRE(*set.Find(2'000) == "again");
+  }
+  UNIT_TEST(SparseSet_CopyAndMove)
+  {
+    SparseSet<i32> set;
+    set.TryEmplace(1, 10);
+    set.TryEmplace(5'000, 20);
+
+    SparseSet<i32> copy(set);
+    UNIT_TEST_REQUIRE(*copy.Find(5'000) == 20);
+
+    SparseSet<i32> assigned;
+    assigned.TryEmplace(9, 90);
+    assigned = set;
+    UNIT_TEST_REQUIRE_FALSE(assigned.Contains(9));
+    UNIT_TEST_REQUIRE(*assigned.Find(1) == 10);
+
+    SparseSet<i32> moved(std::move(set));
+    UNIT_TEST_REQUIRE(moved.Size() == 2);
+    UNIT_TEST_REQUIRE(*moved.Find(1) == 10);
+  }
+}
@@ -0,0 +1,64 @@
+#include <Core/Container/StridedSpan.h>
+#include <Core/Container/Vector.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(Span)
+{
+  using Core::Span;
+  using Core::StridedSpan;
+
+  struct Particle
+  {
+    f32 Position_[3];
+    f32 Mass_;
+    u8  Flags_;
+  };
+
+  UNIT_TEST(StridedSpan_MemberOfArrayOfStructs)
+  {
+    Core::Vector<Particle> particles;
+    for (i32 i = 0; i < 10; ++i)
+      particles.EmplaceBack(Particle{{f32(i), 0.f, 0.f}, f32(i) * 2.f, u8(i)});
+
+    StridedSpan<f32> masses = Core::MemberSpan(Span<Particle>(particles), &Particle::Mass_);
+    UNIT_TEST_REQUIRE(masses.Size() == 10);
+    UNIT_TEST_REQUIRE(masses.Stride() == (i32)sizeof(Particle));
+    UNIT_TEST_REQUIRE_FALSE(masses.IsContiguous());
+
+    masses.ForEach([](f32& mass) { mass += 1.f; });
+    for (i32 i = 0; i < 10; ++i)
+      UNIT_TEST_REQUIRE(particles[i].Mass_ == f32(i) * 2.f + 1.f);
+
+    Particle const* constParticles = particles.Data();
+    StridedSpan<u8 const> flags    = Core::MemberSpan(Span<Particle const>(constParticles, 10), &Particle::Flags_);
+    i32                   sum      = 0;
+    for (u8 const flag : flags)
+      sum += flag;
+    UNIT_TEST_REQUIRE(sum == 45);
+  }
+  UNIT_TEST(StridedSpan_SubViews)
+  {
+    i32 items[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    StridedSpan<i32> all(items, 12);
+    UNIT_TEST_REQUIRE(all.IsContiguous());
+    UNIT_TEST_REQUIRE(all.AsSpan().Size() == 12);
+
+    StridedSpan<i32> evens = all.Every(2);
+    UNIT_TEST_REQUIRE(evens.Size() == 6);
+    UNIT_TEST_REQUIRE(evens[5] == 10);
+    UNIT_TEST_REQUIRE(evens.SubSpan(1, 3)[2] == 6);
+    UNIT_TEST_REQUIRE(evens.Last(2)[0] == 8);
+    UNIT_TEST_REQUIRE(all.Every(5).Size() == 3);
+
+    StridedSpan<i32> reversed = evens.Reversed();
+    i32              expected = 10;
+    for (i32 const item : reversed)
+    {
+      UNIT_TEST_REQUIRE(item == expected);
+      expected -= 2;
+    }
+    UNIT_TEST_REQUIRE(expected == -2);
+    UNIT_TEST_REQUIRE(reversed.end() - reversed.begin() == 6);
+  }
+}
@@ -0,0 +1,132 @@
+#include <Core/Allocator/TrackingAllocator.h>
+#include <Core/Container/String.h>
+#include <UnitTest/UnitTest.h>
+
+UNIT_TEST_SUITE(String)
+{
+  using Core::String;
+  using Core::StringView;
+
+  UNIT_TEST(String_SizeOfStaysThreePointers)
+  {
+    UNIT_TEST_REQUIRE(sizeof(String<char>) == sizeof(void*) + 16);
+    UNIT_TEST_REQUIRE(sizeof(String<wchar_t>) == sizeof(void*) + 16);
+  }
+  UNIT_TEST(String_DefaultCtor_IsEmptyAndTerminated)
+  {
+    String<char> s;
+    UNIT_TEST_REQUIRE(s.IsEmpty());
+    UNIT_TEST_REQUIRE(s.Size() == 0);
+    UNIT_TEST_REQUIRE(s.Data() != nullptr);
+    UNIT_TEST_REQUIRE(s.Data()[0] == '\0');
+    UNIT_TEST_REQUIRE(s.begin() == s.end());
+  }
+  UNIT_TEST(String_ShortStrings_DontAllocate)
+  {
+    Core::TrackingAllocator alloc;
+    String<char>            s("0123456789abcde", &alloc);
+    UNIT_TEST_REQUIRE(s.Size() == 15);
+    UNIT_TEST_REQUIRE(s.Capacity() == 15);
+    UNIT_TEST_REQUIRE(s.Data()[15] == '\0');
+    UNIT_TEST_REQUIRE(s == "0123456789abcde");
+
+    String<wchar_t> ws(L"abc", &alloc);
+    UNIT_TEST_REQUIRE(ws.Size() == 3);
+    UNIT_TEST_REQUIRE(ws == L"abc");
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 0);
+  }
+  UNIT_TEST(String_LongStrings_SpillToTheAllocator)
+  {
+    Core::TrackingAllocator alloc;
+    {
+      String<char> s("0123456789abcdef", &alloc);
+      UNIT_TEST_REQUIRE(s.Size() == 16);
+      UNIT_TEST_REQUIRE(s.Data()[16] == '\0');
+      UNIT_TEST_REQUIRE(s == "0123456789abcdef");
+      UNIT_TEST_REQUIRE(alloc.GetTotalStats().AllocCount_ == 1);
+    }
+    UNIT_TEST_REQUIRE(alloc.GetTotalStats().LiveCount_ == 0);
+  }
+  UNIT_TEST(String_PushBack_CrossesTheInlineCapacity)
+  {
+    String<char> s;
+    for (i32 i = 0; i < 40; ++i)
+      s += "x";
+    UNIT_TEST_REQUIRE(s.Size() == 40);
+    UNIT_TEST_REQUIRE(s.Data()[40] == '\0');
+    for (char const c : s)
+      UNIT_TEST_REQUIRE(c == 'x');
+
+    s.Resize(3);
+    UNIT_TEST_REQUIRE(s == "xxx");
+    s.PopBack();
+    UNIT_TEST_REQUIRE(s == "xx");
+  }
+  UNIT_TEST(String_InsertAndErase)
+  {
+    String<char> s("held");
+    s.Insert(2, "llo wor");
+    UNIT_TEST_REQUIRE(s == "hello world");
+    s.Insert(s.end(), ", and a longer tail");
+    UNIT_TEST_REQUIRE(s == "hello world, and a longer tail");
+    s.Erase(5, 25);
+    UNIT_TEST_REQUIRE(s == "hello");
+    s.Erase(0);
+    UNIT_TEST_REQUIRE(s == "ello");
+    UNIT_TEST_REQUIRE(s.Erase(s.end()) == s.end());
+  }
+  UNIT_TEST(String_Assign_IgnoresTrailingTerminatorAndSelfViews)
+  {
+    String<char> s;
+    s.Assign(StringView<char>("abc", 4));
+    UNIT_TEST_REQUIRE(s.Size() == 3);
+
+    s.Assign("a string long enough for the heap");
+    s.Assign(s.AsView().SubStr(2, 6));
+    UNIT_TEST_REQUIRE(s == "string");
+
+    s.Assign('z', 20);
+    UNIT_TEST_REQUIRE(s.Size() == 20);
+    UNIT_TEST_REQUIRE(s.Back() == 'z');
+  }
+  UNIT_TEST(String_ResizeUninitialized_KeepsTerminator)
+  {
+    String<char> s;
+    s.ResizeUninitialized(32);
+    UNIT_TEST_REQUIRE(s.Size() == 32);
+    UNIT_TEST_REQUIRE(s.Data()[32] == '\0');
+  }
+  UNIT_TEST(String_CopyAndMove)
+  {
+    String<char> shortStr("short");
+    String<char> longStr("a string that lives on the heap");
+
+    String<char> shortCopy(shortStr);
+    String<char> longCopy(longStr);
+    UNIT_TEST_REQUIRE(shortCopy == shortStr.AsView());
+    UNIT_TEST_REQUIRE(longCopy.Data() != longStr.Data());
+
+    char const*  longData = longStr.Data();
+    String<char> longMoved(std::move(longStr));
+    UNIT_TEST_REQUIRE(longMoved.Data() == longData);
+    UNIT_TEST_REQUIRE(longStr.IsEmpty());
+
+    String<char> shortMoved;
+    shortMoved = std::move(shortStr);
+    UNIT_TEST_REQUIRE(shortMoved == "short");
+    UNIT_TEST_REQUIRE(shortStr.IsEmpty());
+
+    shortMoved = longCopy;
+    UNIT_TEST_REQUIRE(shortMoved == longCopy.AsView());
+  }
+  UNIT_TEST(String_CalculateHash_MatchesView)
+  {
+    String<char> const inlineStr("name");
+    String<char> const heapStr("a name that doesn't fit inline");
+    UNIT_TEST_REQUIRE(inlineStr.CalculateHash() == StringView<char>("name").CalculateHash());
+    UNIT_TEST_REQUIRE(heapStr.CalculateHash() == StringView<char>("a name that doesn't fit inline").CalculateHash());
+
+    String<char> const emptyStr;
+    UNIT_TEST_REQUIRE(emptyStr.CalculateHash() == StringView<char>().CalculateHash());
+  }
+}
@@ -1,3 +1,5 @@
+#include <Core/Container/InlineVector.h>
+#include <Core/Container/String.h>
 #include <Core/Container/Vector.h>
 #include <UnitTest/UnitTest.h>
 
@@ -7,7 +9,7 @@ UNIT_TEST_SUITE(Container)
 
   struct NullAllocator : Core::IAllocator
   {
-    void* Alloc(i64 const, i32 const)
+    void* Alloc(i64 const, i32 const, Core::AllocFlags const)
     {
       return nullptr;
     }
@@ -32,6 +34,49 @@ UNIT_TEST_SUITE(Container)
     }
   };
 
+  // Records the sizes passed to the sized overloads
+  struct SizedAllocator : Core::IAllocator
+  {
+    i64 LastReallocOldSize_ = -1;
+    i64 LastFreedSize_      = -1;
+
+    void* Alloc(i64 const size, i32 const alignment, Core::AllocFlags const flags)
+    {
+      return Core::GetGlobalAllocator()->Alloc(size, alignment, flags);
+    }
+    void* Realloc(void*, i64 const, i32 const)
+    {
+      return nullptr;
+    }
+    void Free(void* p, i32 const alignment)
+    {
+      Core::GetGlobalAllocator()->Free(p, alignment);
+    }
+    void* ReallocSized(void* p, i64 const oldSize, i64 const size, i32 const alignment)
+    {
+      LastReallocOldSize_ = oldSize;
+      return Realloc(p, size, alignment);
+    }
+    void FreeSized(void* p, i64 const size, i32 const alignment)
+    {
+      if (p)
+        LastFreedSize_ = size;
+      Free(p, alignment);
+    }
+    bool IsMovable()
+    {
+      return true;
+    }
+    bool IsCopyable()
+    {
+      return true;
+    }
+    bool OwnedByContainer()
+    {
+      return false;
+    }
+  };
+
   UNIT_TEST(Vector_TrivialType_DefaultCtor)
   {
     Vector<int> v;
@@ -151,6 +196,18 @@ UNIT_TEST_SUITE(Container)
     UNIT_TEST_REQUIRE(v0.Allocator() == v1.Allocator());
     UNIT_TEST_REQUIRE(memcmp(v0.Data(), v1.Data(), (u64)v0.AllocSize()) == 0);
   }
+  UNIT_TEST(Vector_TrivialType_CopyAssignOverExisting)
+  {
+    Vector<int> v0{0, 1, 2, 3};
+    Vector<int> v1{4, 5};
+    v1 = v0;
+    UNIT_TEST_REQUIRE(v1.Size() == 4);
+    UNIT_TEST_REQUIRE(memcmp(v0.Data(), v1.Data(), (u64)v0.AllocSize()) == 0);
+
+    v1 = v1;
+    UNIT_TEST_REQUIRE(v1.Size() == 4);
+    UNIT_TEST_REQUIRE(v1[3] == 3);
+  }
   UNIT_TEST(Vector_TrivialType_MoveAssignFromEmpty)
   {
     Vector<int> v0;
@@ -270,6 +327,52 @@ UNIT_TEST_SUITE(Container)
     for (i32 i = 10; i < 20; ++i)
       UNIT_TEST_REQUIRE(v[i] == 99);
   }
+  UNIT_TEST(Vector_TrivialType_ResizeAppendsZeroedElementsToNonEmptyVector)
+  {
+    Vector<int> v(4, 42);
+    v.Resize(8);
+    UNIT_TEST_REQUIRE(v.Size() == 8);
+    for (i32 i = 0; i < 4; ++i)
+      UNIT_TEST_REQUIRE(v[i] == 42);
+    for (i32 i = 4; i < 8; ++i)
+      UNIT_TEST_REQUIRE(v[i] == 0);
+    v.Resize(2);
+    UNIT_TEST_REQUIRE(v.Size() == 2);
+  }
+  UNIT_TEST(Vector_TrivialType_CtorWithSizeIsZeroed)
+  {
+    Vector<int> v(1'024);
+    for (auto const& value : v)
+      UNIT_TEST_REQUIRE(value == 0);
+  }
+  UNIT_TEST(Vector_TrivialType_ResizeUninitializedKeepsExistingElements)
+  {
+    Vector<int> v(10, 42);
+    v.ResizeUninitialized(100);
+    UNIT_TEST_REQUIRE(v.Size() == 100);
+    UNIT_TEST_REQUIRE(v.Capacity() >= 100);
+    for (i32 i = 0; i < 10; ++i)
+      UNIT_TEST_REQUIRE(v[i] == 42);
+  }
+  UNIT_TEST(Vector_TrivialType_FreesWithTheAllocatedSize)
+  {
+    SizedAllocator alloc;
+    {
+      Vector<i64> v(&alloc);
+      v.Reserve(10);
+      v.Reserve(20);
+      UNIT_TEST_REQUIRE(alloc.LastReallocOldSize_ == 10 * (i64)sizeof(i64));
+      UNIT_TEST_REQUIRE(alloc.LastFreedSize_ == 10 * (i64)sizeof(i64));
+    }
+    UNIT_TEST_REQUIRE(alloc.LastFreedSize_ == 20 * (i64)sizeof(i64));
+  }
+  UNIT_TEST(Vector_TrivialType_ResizeUninitializedShrinks)
+  {
+    Vector<int> v(10, 42);
+    v.ResizeUninitialized(3);
+    UNIT_TEST_REQUIRE(v.Size() == 3);
+    UNIT_TEST_REQUIRE(v.Capacity() == 10);
+  }
   UNIT_TEST(Vector_TrivialType_ClearOfEmptyDoesNothing)
   {
     Vector<int> v;
@@ -1470,4 +1573,146 @@ UNIT_TEST_SUITE(Container)
     UNIT_TEST_REQUIRE(v0 == v1);
     UNIT_TEST_REQUIRE_FALSE(v0 != v1);
   }
+  // Points into itself, so it's only valid if moved through its constructor
+  struct SelfPointer
+  {
+    i32  Value_;
+    i32* Self_;
+
+    SelfPointer(i32 const value)
+        : Value_(value)
+        , Self_(&Value_)
+    {
+    }
+    SelfPointer(SelfPointer&& other)
+        : Value_(other.Value_)
+        , Self_(&Value_)
+    {
+    }
+    SelfPointer& operator=(SelfPointer&& other)
+    {
+      Value_ = other.Value_;
+      return *this;
+    }
+
+    bool IsValid(i32 const expected) const
+    {
+      return Self_ == &Value_ && Value_ == expected;
+    }
+  };
+
+  UNIT_TEST(Vector_Relocation_Traits)
+  {
+    static_assert(Core::IsTriviallyRelocatable<i32>);
+    static_assert(Core::IsTriviallyRelocatable<Vector<SelfPointer>>);
+    static_assert(Core::IsTriviallyRelocatable<Core::String<char>>);
+    static_assert(!Core::IsTriviallyRelocatable<SelfPointer>);
+    static_assert(!Core::IsTriviallyRelocatable<Core::InlineVector<i32, 4>>);
+    UNIT_TEST_REQUIRE(true);
+  }
+  UNIT_TEST(Vector_Relocation_NonRelocatableTypeIsMoveConstructed)
+  {
+    Vector<SelfPointer> v;
+    for (i32 i = 0; i < 100; ++i)
+      v.EmplaceBack(i);
+
+    v.Emplace(v.begin() + 10, -1);
+    v.Erase(v.begin() + 50, v.begin() + 60);
+    UNIT_TEST_REQUIRE(v.Size() == 91);
+    for (i32 i = 0; i < v.Size(); ++i)
+    {
+      i32 const expected = i < 10 ? i : i == 10 ? -1 : i <= 49 ? i - 1 : i + 9;
+      UNIT_TEST_REQUIRE(v[i].IsValid(expected));
+    }
+  }
+  UNIT_TEST(Vector_Relocation_InsertAndEraseStrings)
+  {
+    char const* const text = "a string long enough to live on the heap";
+
+    Vector<Core::String<char>> v;
+    for (i32 i = 0; i < 20; ++i)
+      v.EmplaceBack(i % 2 == 0 ? text : "short");
+
+    v.Insert(v.begin() + 5, 3, Core::String<char>("inserted"));
+    v.Erase(v.begin(), v.begin() + 2);
+    UNIT_TEST_REQUIRE(v.Size() == 21);
+    UNIT_TEST_REQUIRE(v[1] == "short");
+    UNIT_TEST_REQUIRE(v[2] == text);
+    UNIT_TEST_REQUIRE(v[3] == "inserted");
+    UNIT_TEST_REQUIRE(v[5] == "inserted");
+    UNIT_TEST_REQUIRE(v[6] == "short");
+    UNIT_TEST_REQUIRE(v[20] == "short");
+  }
+  UNIT_TEST(Vector_Relocation_NestedInlineVectorsSurviveGrowth)
+  {
+    Vector<Core::InlineVector<i32, 4>> v;
+    for (i32 i = 0; i < 50; ++i)
+    {
+      v.EmplaceBack();
+      v.Back().EmplaceBack(i);
+      v.Back().EmplaceBack(i + 1);
+    }
+
+    for (i32 i = 0; i < 50; ++i)
+    {
+      UNIT_TEST_REQUIRE(v[i].Size() == 2);
+      UNIT_TEST_REQUIRE(v[i][1] == i + 1);
+    }
+  }
+  UNIT_TEST(Vector_GrowthPolicies)
+  {
+    static_assert(Core::GeometricGrowth<>::Grow(0, 5) == 5);
+    static_assert(Core::GeometricGrowth<>::Grow(4, 5) == 8);
+    static_assert(Core::GeometricGrowth<3, 2>::Grow(4, 7) == 9);
+    static_assert(Core::GeometricGrowth<3, 2>::Grow(1, 2) == 2);
+    static_assert(Core::GeometricGrowth<>::Grow(1'500'000'000, 1'600'000'000) == 2'147'483'647);
+    static_assert(Core::GeometricGrowth<>::Grow(1'500'000'000ll, 1'600'000'000ll) == 3'000'000'000ll);
+    static_assert(Core::LinearGrowth<64>::Grow(64, 65) == 128);
+    static_assert(Core::ExactGrowth::Grow(64, 65) == 65);
+
+    Vector<i32, i32, Core::LinearGrowth<16>> linear;
+    for (i32 i = 0; i < 40; ++i)
+      linear.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(linear.Capacity() == 48);
+
+    Vector<i32, i32, Core::ExactGrowth> exact;
+    for (i32 i = 0; i < 40; ++i)
+      exact.EmplaceBack(i);
+    UNIT_TEST_REQUIRE(exact.Capacity() == 40);
+    UNIT_TEST_REQUIRE(exact[39] == 39);
+  }
+  UNIT_TEST(Vector_ShrinkToFit)
+  {
+    Vector<Core::String<char>> v;
+    v.Reserve(100);
+    for (i32 i = 0; i < 10; ++i)
+      v.EmplaceBack("a string long enough to live on the heap");
+
+    v.ShrinkToFit();
+    UNIT_TEST_REQUIRE(v.Capacity() == 10);
+    UNIT_TEST_REQUIRE(v[9] == "a string long enough to live on the heap");
+
+    v.Clear();
+    v.ShrinkToFit();
+    UNIT_TEST_REQUIRE(v.Capacity() == 0);
+    UNIT_TEST_REQUIRE(v.Data() == nullptr);
+  }
+  UNIT_TEST(LargeVector_SizesAre64Bit)
+  {
+    Core::LargeVector<u8> bytes(1'000, u8(7));
+    static_assert(std::is_same_v<decltype(bytes.Size()), i64>);
+    UNIT_TEST_REQUIRE(bytes.Size() == 1'000);
+    UNIT_TEST_REQUIRE(bytes.AllocSize() == 1'000);
+
+    bytes.Insert(500ll, 10ll, u8(1));
+    bytes.Erase(0ll, 100ll);
+    UNIT_TEST_REQUIRE(bytes.Size() == 910);
+    UNIT_TEST_REQUIRE(bytes[399] == 7);
+    UNIT_TEST_REQUIRE(bytes[400] == 1);
+    UNIT_TEST_REQUIRE(bytes[409] == 1);
+    UNIT_TEST_REQUIRE(bytes[410] == 7);
+
+    // Byte sizes are 64-bit for every Vector
+    static_assert(std::is_same_v<decltype(Vector<u64>().AllocSize()), i64>);
+  }
 }
@@ -0,0 +1,79 @@
+#include <Core/Allocator/GlobalAllocator.h>
+#include <Core/Name/Name.h>
+#include <UnitTest/UnitTest.h>
+#include <cstdio>
+#include <thread>
+
+UNIT_TEST_SUITE(Name)
+{
+  using Core::Name;
+
+  UNIT_TEST(Name_DefaultIsNoneAndEmpty)
+  {
+    Name const none;
+    UNIT_TEST_REQUIRE(none.IsNone());
+    UNIT_TEST_REQUIRE(none.AsView().IsEmpty());
+    UNIT_TEST_REQUIRE(none.CStr()[0] == '\0');
+    UNIT_TEST_REQUIRE(Name("") == none);
+  }
+  UNIT_TEST(Name_SameStringSameName)
+  {
+    Name const a("Name_SameStringSameName");
+    Name const b(Core::String<char>("Name_SameStringSameName").AsView());
+    UNIT_TEST_REQUIRE_FALSE(a.IsNone());
+    UNIT_TEST_REQUIRE(a == b);
+    UNIT_TEST_REQUIRE(a.CalculateHash() == b.CalculateHash());
+    UNIT_TEST_REQUIRE(a.AsView() == "Name_SameStringSameName");
+    UNIT_TEST_REQUIRE(a.CStr()[a.AsView().Size()] == '\0');
+    UNIT_TEST_REQUIRE(a != Name("Name_SameStringSameName2"));
+  }
+  UNIT_TEST(Name_FindNeverInserts)
+  {
+    i32 const count = Name::InternedCount();
+    UNIT_TEST_REQUIRE(Name::Find("Name_FindNeverInserts").IsNone());
+    UNIT_TEST_REQUIRE(Name::InternedCount() == count);
+
+    Name const interned("Name_FindNeverInserts");
+    UNIT_TEST_REQUIRE(Name::Find("Name_FindNeverInserts") == interned);
+  }
+  UNIT_TEST(Name_ManyNames_GrowTheTable)
+  {
+    char buf[64];
+    for (i32 i = 0; i < 5000; ++i)
+    {
+      i32 const len = snprintf(buf, sizeof(buf), "Name_ManyNames_%d", i);
+      Name const n(Core::StringView<char>(buf, len));
+      UNIT_TEST_REQUIRE(n.AsView() == Core::StringView<char>(buf, len));
+    }
+    UNIT_TEST_REQUIRE(Name::Find("Name_ManyNames_0").AsView() == "Name_ManyNames_0");
+    UNIT_TEST_REQUIRE(Name::Find("Name_ManyNames_4999").AsView() == "Name_ManyNames_4999");
+  }
+  UNIT_TEST(Name_ConcurrentInterning_AgreesOnIndices)
+  {
+    constexpr i32 ThreadCount = 4;
+    constexpr i32 NameCount   = 2000;
+
+    u32         indices[ThreadCount][NameCount];
+    std::thread threads[ThreadCount];
+    for (i32 t = 0; t < ThreadCount; ++t)
+    {
+      threads[t] = std::thread([&indices, t]() {
+        Core::GlobalAllocator::ThreadScope allocatorThread;
+        char                               buf[64];
+        for (i32 i = 0; i < NameCount; ++i)
+        {
+          i32 const len  = snprintf(buf, sizeof(buf), "Name_Concurrent_%d", i);
+          indices[t][i] = Name(Core::StringView<char>(buf, len)).Index();
+        }
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+
+    for (i32 t = 1; t < ThreadCount; ++t)
+    {
+      for (i32 i = 0; i < NameCount; ++i)
+        UNIT_TEST_REQUIRE(indices[t][i] == indices[0][i]);
+    }
+  }
+}
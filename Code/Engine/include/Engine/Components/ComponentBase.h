@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include <Core/Container/BitSet.h>
 #include <Core/Definitions.h>
 #include <Engine/Reflection/Reflection.h>
 #include <Engine/API.h>
@@ -36,4 +37,27 @@ public:
 
 template <typename T>
 concept Component = std::derived_from<T, ComponentBase>;
+
+// Bit i of a signature stands for the component type whose TypeMetaData::KindIndex_ is i.
+inline constexpr i32 MaxComponentTypes = 256;
+using ComponentSignature               = Core::BitSet<MaxComponentTypes>;
+
+template <Component T>
+i32 ComponentTypeIndex()
+{
+  i32 const index = i32(T::GetStaticTypeMetaData().KindIndex_);
+  checkf(index < MaxComponentTypes, "Too many component types, raise MaxComponentTypes.");
+  return index;
+}
+
+template <Component... ComponentTypes>
+ComponentSignature const& MakeComponentSignature()
+{
+  static ComponentSignature const signature = [] {
+    ComponentSignature bits;
+    (bits.Set(ComponentTypeIndex<ComponentTypes>()), ...);
+    return bits;
+  }();
+  return signature;
+}
 } // namespace Engine::Components
@@ -1,24 +1,37 @@
 ﻿#pragma once
 
 #include <Core/Container/FlatMap.h>
-#include <Core/Container/String.h>
+#include <Core/Container/InlineVector.h>
+#include <Core/Name/Name.h>
 #include <Engine/API.h>
 #include <Engine/Components/ComponentBase.h>
 #include <Engine/Components/TransformComponent.h>
 #include <Engine/Reflection/Reflection.h>
 #include <concepts>
 
+namespace Engine
+{
+class EntityComponentSubSystem;
+}
+
 namespace Engine::Entities
 {
 class ENGINE_API ActorBase
 {
   GE_DECLARE_CLASS_TYPE_METADATA()
 
+  friend class Engine::EntityComponentSubSystem;
+
+  // Handle given by the EntityComponentSubSystem when spawned, 0 until then
   u64 ID_;
 
-  Core::CompactFlatMap<u64, Components::ComponentBase*> Components_;
+  // Most actors have a handful of components, kept inline to avoid an allocation per actor
+  Core::CompactFlatMap<u64, Components::ComponentBase*, Core::InlineStorage<4>::Type> Components_;
+
+  // One bit per attached component type, answers "has component" without searching Components_
+  Components::ComponentSignature ComponentSignature_;
 
-  Core::String<char> Name_;
+  Core::Name Name_;
 
 public:
   Components::TransformComponent Transform_;
@@ -30,10 +43,21 @@ public:
   ActorBase& operator=(ActorBase&&)      = delete;
   virtual ~ActorBase()                   = default;
 
-  void SetName(Core::String<char> Name);
+  void SetName(Core::Name Name);
 
-  [[nodiscard]] u64                    ID() const;
-  [[nodiscard]] Core::StringView<char> Name() const;
+  [[nodiscard]] u64        ID() const;
+  [[nodiscard]] Core::Name Name() const;
+
+  [[nodiscard]] Components::ComponentSignature const& Signature() const
+  {
+    return ComponentSignature_;
+  }
+
+  template <Components::Component... ComponentTypes>
+  [[nodiscard]] bool HasComponents() const
+  {
+    return ComponentSignature_.ContainsAll(Components::MakeComponentSignature<ComponentTypes...>());
+  }
 
   virtual void PreInitialize();
   virtual void PostInitialize();
@@ -47,15 +71,17 @@ public:
   template <Components::Component Component>
   [[nodiscard]] Component* AttachComponent()
   {
-    u64 const ID = Component::GetStaticTypeMetaData().ID_;
-    if (Components_.Contains(ID))
+    u64 const ID    = Component::GetStaticTypeMetaData().ID_;
+    i32 const index = Components::ComponentTypeIndex<Component>();
+    if (ComponentSignature_.Test(index))
       return nullptr;
 
-    auto* component = new Component();
+    auto* component = (Component*)Component::GetStaticTypeMetaData().Factory_();
     component->PreAttach(*this);
 
     bool const success = Components_.TryEmplace(ID, component);
     check(success);
+    ComponentSignature_.Set(index);
 
     component->PostAttach(*this);
     return component;
@@ -66,18 +92,23 @@ public:
   {
     u64 const ID        = Component::GetStaticTypeMetaData().ID_;
     auto*     component = FindComponent<Component>();
-    if (verifyf(component != nullptr, "Component %s not found in %.*s.", Component::GetStaticTypeMetaData().Name_, Name_.Size(), Name_.Data()))
+    if (verifyf(component != nullptr, "Component %s not found in %s.", Component::GetStaticTypeMetaData().Name_, Name_.CStr()))
     {
       component->PreDetach(*this);
       bool const success = Components_.TryRemove(ID);
       check(success);
+      ComponentSignature_.Reset(Components::ComponentTypeIndex<Component>());
       component->PostDetach(*this);
+      component->GetTypeMetaData().Destroy_(component);
     }
   }
 
   template <Components::Component Component>
   [[nodiscard]] Component* FindComponent()
   {
+    if (!ComponentSignature_.Test(Components::ComponentTypeIndex<Component>()))
+      return nullptr;
+
     u64 const ID    = Component::GetStaticTypeMetaData().ID_;
     auto**    found = Components_.Find(ID);
     return found ? (Component*)*found : nullptr;
@@ -86,6 +117,9 @@ public:
   template <Components::Component Component>
   [[nodiscard]] Component const* FindComponent() const
   {
+    if (!ComponentSignature_.Test(Components::ComponentTypeIndex<Component>()))
+      return nullptr;
+
     u64 const    ID    = Component::GetStaticTypeMetaData().ID_;
     auto* const* found = Components_.Find(ID);
     return found ? (Component const*)*found : nullptr;
@@ -95,7 +129,7 @@ public:
   [[nodiscard]] Component* FindComponentChecked()
   {
     auto* found = FindComponent<Component>();
-    checkf(found, "Failed to find component %s for actor %.*s.", Component::GetStaticTypeMetaData().Name_, Name().Size(), Name().Data());
+    checkf(found, "Failed to find component %s for actor %s.", Component::GetStaticTypeMetaData().Name_, Name_.CStr());
     return found;
   }
 
@@ -103,7 +137,7 @@ public:
   [[nodiscard]] Component const* FindComponentChecked() const
   {
     auto const* found = FindComponent<Component>();
-    checkf(found, "Failed to find component %s for actor %.*s.", Component::GetStaticTypeMetaData().Name_, Name().Size(), Name().Data());
+    checkf(found, "Failed to find component %s for actor %s.", Component::GetStaticTypeMetaData().Name_, Name_.CStr());
     return found;
   }
 };
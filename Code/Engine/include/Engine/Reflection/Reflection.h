@@ -1,12 +1,15 @@
 #pragma once
 
-#include <Core/Container/FlatMap.h>
+#include <Core/Allocator/PoolAllocator.h>
+#include <Core/Container/BucketArray.h>
+#include <Core/Container/HashMap.h>
 #include <Core/Container/Span.h>
 #include <Core/Container/Vector.h>
 #include <Core/Helpers.h>
 #include <Engine/API.h>
 #include <Engine/Serialization/Serialization.h>
 #include <concepts>
+#include <new>
 
 namespace Engine
 {
@@ -27,15 +30,20 @@ struct TypeMetaData
   };
 
   using FactoryFn     = void* (*)();
+  using DestroyFn     = void (*)(void*);
+  using BucketsFn     = void* (*)();
   using SerializeFn   = void (*)(void*, u32&, Core::Vector<u8>&);
   using DeserializeFn = void (*)(void*, Serialization::SerializationHeader const&, Core::Span<u8 const>);
 
   // Since this might be serialized, we version the metadata also.
   u16 const     Version_ = 0;
   u16           Kind_{};
+  u32           KindIndex_{}; // Dense index among the types of the same Kind, in registration order
   u64           ID_{};
   char const*   Name_{};
   FactoryFn     Factory_{};
+  DestroyFn     Destroy_{}; // Releases an instance created by Factory_
+  BucketsFn     Buckets_{}; // Actors only, the Core::BucketArray<T> holding the instances of the type
   SerializeFn   Serialize_{};
   DeserializeFn Deserialize_{};
 };
@@ -52,14 +60,80 @@ concept Serializable = requires(T t) {
   t.Deserialize(std::declval<Serialization::SerializationHeader const>, std::declval<Core::Span<u8 const>>);
 };
 
+namespace Private
+{
+// Every reflected type gets its own pool, so instances created through TypeMetaData::Factory_ are packed together.
+template <typename T>
+Core::PoolAllocator<sizeof(T), alignof(T)>& GetTypePool()
+{
+  static Core::PoolAllocator<sizeof(T), alignof(T)> pool;
+  return pool;
+}
+
+template <typename T>
+void* CreatePooled()
+{
+  void* mem = GetTypePool<T>().Alloc(sizeof(T), alignof(T));
+  checkf(mem, "Failed to allocate a pooled instance.");
+  return new (mem) T();
+}
+
+template <typename T>
+void DestroyPooled(void* Instance)
+{
+  if (Instance)
+  {
+    ((T*)Instance)->~T();
+    GetTypePool<T>().Free(Instance, alignof(T));
+  }
+}
+
+// Actors get a bucket array per type instead: they never move while alive, and iterating
+// the actors of a type stays linear in memory whatever the spawn and despawn churn.
+template <typename T>
+Core::BucketArray<T>& GetTypeBuckets()
+{
+  static Core::BucketArray<T> buckets;
+  return buckets;
+}
+
+template <typename T>
+void* CreateInBuckets()
+{
+  return GetTypeBuckets<T>().Emplace();
+}
+
+template <typename T>
+void DestroyInBuckets(void* Instance)
+{
+  if (Instance)
+    GetTypeBuckets<T>().Erase((T*)Instance);
+}
+
+// GetTypeBuckets<T>() is a static of a header template: with shared libraries, every module instantiating it gets
+// its own array. Only the copy of the module defining the metadata of T is filled, other modules reach it through
+// TypeMetaData::Buckets_.
+template <typename T>
+void* GetTypeBucketsErased()
+{
+  return &GetTypeBuckets<T>();
+}
+} // namespace Private
+
+// Hands out the next free TypeMetaData::KindIndex_ of `Kind`.
+ENGINE_API u32 AllocateKindIndex(u16 Kind);
+
 template <typename T>
 TypeMetaData MakeMetaData(u64 const ID, char const* Name, u16 const Kind)
 {
   return {
-      .Kind_    = Kind,
-      .ID_      = ID,
-      .Name_    = Name,
-      .Factory_ = +[]() -> void* { return new T(); },
+      .Kind_      = Kind,
+      .KindIndex_ = AllocateKindIndex(Kind),
+      .ID_        = ID,
+      .Name_      = Name,
+      .Factory_   = Kind == TypeMetaData::Actor ? &Private::CreateInBuckets<T> : &Private::CreatePooled<T>,
+      .Destroy_   = Kind == TypeMetaData::Actor ? &Private::DestroyInBuckets<T> : &Private::DestroyPooled<T>,
+      .Buckets_   = Kind == TypeMetaData::Actor ? &Private::GetTypeBucketsErased<T> : nullptr,
   };
 }
 
@@ -68,15 +142,18 @@ TypeMetaData MakeMetaData(u64 const ID, char const* Name, u16 const Kind)
 {
   return {
       .Kind_        = Kind,
+      .KindIndex_   = AllocateKindIndex(Kind),
       .ID_          = ID,
       .Name_        = Name,
-      .Factory_     = +[]() -> void* { return new T(); },
+      .Factory_     = Kind == TypeMetaData::Actor ? &Private::CreateInBuckets<T> : &Private::CreatePooled<T>,
+      .Destroy_     = Kind == TypeMetaData::Actor ? &Private::DestroyInBuckets<T> : &Private::DestroyPooled<T>,
+      .Buckets_     = Kind == TypeMetaData::Actor ? &Private::GetTypeBucketsErased<T> : nullptr,
       .Serialize_   = +[](void* Instance, void* Data) { ((T*)Instance)->Serialize(Data); },
       .Deserialize_ = +[](void* Instance, void* Data) { ((T*)Instance)->Deserialize(Data); },
   };
 }
 
-ENGINE_API Core::CompactFlatMap<u64, TypeMetaData const*>& GetTypesMetaData();
+ENGINE_API Core::HashMap<u64, TypeMetaData const*>& GetTypesMetaData();
 
 template <typename T>
 struct AutoRegisterTypeMetadata
@@ -1,6 +1,6 @@
 ﻿#pragma once
 
-#include <Core/Container/FlatMap.h>
+#include <Core/Container/SlotMap.h>
 #include <Engine/Entities/ActorBase.h>
 #include <Engine/SubSystems/EngineSubSystem.h>
 
@@ -10,7 +10,8 @@ class ENGINE_API EntityComponentSubSystem : public EngineSubSystem
 {
   GE_DECLARE_CLASS_TYPE_METADATA()
 
-  Core::CompactFlatMap<u64, Entities::ActorBase*> Actors_;
+  // Actor IDs are the packed handles of this map, stale IDs are detected by their generation
+  Core::SlotMap<Entities::ActorBase*> Actors_;
 
 public:
   void PreInitialize() override;
@@ -28,5 +29,25 @@ public:
   {
     return (T*)SpawnActor(T::GetStaticTypeMetaData().ID_, Name, WorldPosition);
   }
+
+  // Visits the spawned actors of exactly the class T (not its subclasses), in memory order.
+  // The buckets are reached through the metadata of T, so every module iterates the same instances.
+  template <Entities::ActorType T, typename Fn>
+  void ForEachActor(Fn&& Visit)
+  {
+    auto& buckets = *(Core::BucketArray<T>*)T::GetStaticTypeMetaData().Buckets_();
+    for (T& actor : buckets)
+      Visit(actor);
+  }
+
+  // Visits the spawned actors having at least all the given component types.
+  template <Components::Component... ComponentTypes, typename Fn>
+  void ForEachActorWith(Fn&& Visit)
+  {
+    Components::ComponentSignature const& wanted = Components::MakeComponentSignature<ComponentTypes...>();
+    for (Entities::ActorBase* actor : Actors_)
+      if (actor->Signature().ContainsAll(wanted))
+        Visit(*actor);
+  }
 };
 } // namespace Engine
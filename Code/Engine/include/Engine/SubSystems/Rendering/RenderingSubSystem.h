@@ -1,6 +1,9 @@
 ﻿#pragma once
 
 #include <Core/Container/FlatMap.h>
+#include <Core/Container/HashMap.h>
+#include <Core/Container/SparseSet.h>
+#include <Core/Container/Vector.h>
 #include <Engine/SubSystems/EngineSubSystem.h>
 
 namespace Engine
@@ -16,8 +19,13 @@ class ENGINE_API RenderingSubSystem : public EngineSubSystem
 {
   GE_DECLARE_CLASS_TYPE_METADATA()
 
-  Core::FlatMap<u64, Core::Vector<Components::ComponentBase*>> RenderingComponents_;
-  Core::CompactFlatMap<u64, u32>                               Shaders_;
+  // Per component type, the components indexed by the slot of their owner actor
+  Core::FlatMap<u64, Core::SparseSet<Components::ComponentBase*>> RenderingComponents_;
+  Core::HashMap<u64, u32>                                         Shaders_;
+
+  // Components attached before their owner was spawned (ie. from its constructor) have no slot to be keyed by yet,
+  // they're registered by the first Tick after the spawn
+  Core::Vector<Components::ComponentBase*> PendingComponents_;
 
 public:
   using Super = EngineSubSystem;
@@ -40,6 +48,8 @@ private:
   static void ResizeViewport(i32 Width, i32 Height);
   void        Cleanup();
   static bool IsComponentHandledByUs(u64 ID);
+  bool        TryRegisterComponent(Components::ComponentBase& Component);
+  void        RegisterPendingComponents();
   void        CompileShaders();
 };
 } // namespace Engine
@@ -4,26 +4,21 @@ GE_DEFINE_TYPE_METADATA(Engine::Entities::ActorBase, Engine::TypeMetaData::Actor
 
 namespace Engine::Entities
 {
-namespace
-{
-std::atomic<i32> ActorIDCounter{0};
-}
-
 ActorBase::ActorBase()
-    : ID_(ActorIDCounter.fetch_add(1, std::memory_order_relaxed))
+    : ID_(0)
 {
 }
-void ActorBase::SetName(Core::String<char> Name)
+void ActorBase::SetName(Core::Name Name)
 {
-  Name_ = std::move(Name);
+  Name_ = Name;
 }
 u64 ActorBase::ID() const
 {
   return ID_;
 }
-Core::StringView<char> ActorBase::Name() const
+Core::Name ActorBase::Name() const
 {
-  return Name_.AsView();
+  return Name_;
 }
 void ActorBase::PreInitialize()
 {
@@ -56,6 +51,8 @@ void ActorBase::Deinitialize()
   PostDeinitialize();
   for (auto* component : Components_.Values())
     component->PostDetach(*this);
+  for (auto* component : Components_.Values())
+    component->GetTypeMetaData().Destroy_(component);
   Components_.Clear();
 }
 } // namespace Engine::Entities
@@ -1,5 +1,6 @@
 #include "Engine/Events/EventHook.h"
 
+#include <Core/Allocator/FrameAllocator.h>
 #include <Engine/GameEngine/GameEngine.h>
 #include <Engine/LogEngine.h>
 #include <Engine/SubSystems/EngineSubSystem.h>
@@ -10,7 +11,7 @@ namespace Engine
 {
 GameEngine::GameEngine()
 {
-  Core::Vector<TypeMetaData const*> subSystemsMetaData;
+  Core::Vector<TypeMetaData const*> subSystemsMetaData(Core::GetFrameAllocator());
   for (auto const& [ID, MetaData] : GetTypesMetaData())
   {
     if (MetaData->Kind_ == TypeMetaData::EngineSubSystem)
@@ -26,7 +27,7 @@ GameEngine::GameEngine()
 GameEngine::~GameEngine()
 {
   for (auto* subSystem : EngineSubSystems_)
-    delete subSystem;
+    subSystem->GetTypeMetaData().Destroy_(subSystem);
 }
 void GameEngine::PreInitialize()
 {
@@ -42,6 +43,8 @@ void GameEngine::PostInitialize()
 }
 void GameEngine::Tick(f32 DeltaTime)
 {
+  Core::GetFrameAllocator()->BeginFrame();
+
   GE_LOG(LogEngine, Core::Verbosity::Debug, "Calling EngineSubSystem::Tick - %.4fs", DeltaTime);
   for (auto* subSystem : EngineSubSystems_)
     subSystem->Tick(DeltaTime);
@@ -2,9 +2,19 @@
 
 namespace Engine
 {
-ENGINE_API Core::CompactFlatMap<u64, TypeMetaData const*>& GetTypesMetaData()
+ENGINE_API Core::HashMap<u64, TypeMetaData const*>& GetTypesMetaData()
 {
-  static Core::CompactFlatMap<u64, TypeMetaData const*> metaData;
+  static Core::HashMap<u64, TypeMetaData const*> metaData;
   return metaData;
 }
+
+ENGINE_API u32 AllocateKindIndex(u16 const Kind)
+{
+  // Types register during static initialization, before any other thread runs
+  static Core::HashMap<u16, u32> nextIndices;
+  u32* next = nextIndices.Find(Kind);
+  if (!next)
+    next = nextIndices.TryEmplace(Kind, 0u);
+  return (*next)++;
+}
 } // namespace Engine
@@ -21,10 +21,10 @@ bool EntityComponentSubSystem::HandleEvent(EventBase& Event)
 }
 EntityComponentSubSystem::~EntityComponentSubSystem()
 {
-  for (auto* actor : Actors_.Values())
+  for (auto* actor : Actors_)
   {
     actor->Deinitialize();
-    delete actor;
+    actor->GetTypeMetaData().Destroy_(actor);
   }
 }
 Entities::ActorBase* EntityComponentSubSystem::SpawnActor(u64 ClassID, Core::StringView<char> Name, Math::Vec3Df WorldPosition)
@@ -37,8 +37,9 @@ Entities::ActorBase* EntityComponentSubSystem::SpawnActor(u64 ClassID, Core::Str
 
     Entities::ActorBase* actor = (Entities::ActorBase*)metaData.Factory_();
 
-    actor->SetName(Name);
+    actor->SetName(Core::Name(Name));
     actor->Transform_.Position_ = WorldPosition;
+    actor->ID_ = Actors_.Insert(actor).ToU64();
     return actor;
   }
   return nullptr;
@@ -46,11 +47,12 @@ Entities::ActorBase* EntityComponentSubSystem::SpawnActor(u64 ClassID, Core::Str
 void EntityComponentSubSystem::DestroyActor(Entities::ActorBase* Actor)
 {
   Actor->Deinitialize();
-  Actors_.TryRemove(Actor->ID());
+  Actors_.Erase(Core::SlotMapHandle::FromU64(Actor->ID()));
+  Actor->GetTypeMetaData().Destroy_(Actor);
 }
 void EntityComponentSubSystem::DestroyActor(u64 const ID)
 {
-  if (auto** actor = Actors_.Find(ID))
+  if (auto** actor = Actors_.Find(Core::SlotMapHandle::FromU64(ID)))
     DestroyActor(*actor);
 }
 } // namespace Engine
@@ -1,4 +1,5 @@
-﻿#include <Core/Platform/Platform.h>
+﻿#include <Core/Container/SlotMap.h>
+#include <Core/Platform/Platform.h>
 #include <Engine/Components/SpriteComponent.h>
 #include <Engine/Components/TransformComponent.h>
 #include <Engine/Entities/ActorBase.h>
@@ -80,6 +81,13 @@ void APIENTRY OpenGLMessageCallback(GLenum Source, GLenum Type, GLuint ID, GLenu
   if (Core::IsDebuggerAttached() && verbosity == Error)
     Core::DebugBreak();
 }
+
+// Actors own at most one component per type, so the slot of the owner identifies the component within its type.
+// Owners not spawned yet have a null handle, and no slot.
+Core::SlotMapHandle OwnerHandle(Entities::ActorBase const& Owner)
+{
+  return Core::SlotMapHandle::FromU64(Owner.ID());
+}
 } // namespace
 
 RenderingSubSystem::RenderingSubSystem()
@@ -89,6 +97,8 @@ RenderingSubSystem::RenderingSubSystem()
 }
 void RenderingSubSystem::Tick(f32 DeltaTime)
 {
+  RegisterPendingComponents();
+
   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
   using namespace Components;
@@ -308,17 +318,8 @@ bool RenderingSubSystem::HandleEvent(EventBase& Event)
     if (!IsComponentHandledByUs(ID))
       return false;
 
-    if (auto* Components = RenderingComponents_.Find(ID))
-    {
-      Components->EmplaceBack(attachedEvent->Component_);
-    }
-    else
-    {
-      auto* components = RenderingComponents_.TryEmplace(ID);
-      checkf(components, "Failed to register component %llu.", ID);
-      if (components)
-        components->EmplaceBack(attachedEvent->Component_);
-    }
+    if (!TryRegisterComponent(*attachedEvent->Component_))
+      PendingComponents_.EmplaceBack(attachedEvent->Component_);
     return true;
   }
 
@@ -328,10 +329,17 @@ bool RenderingSubSystem::HandleEvent(EventBase& Event)
     if (!IsComponentHandledByUs(ID))
       return false;
 
+    // Still pending when detached before the next Tick, whether its owner was spawned since or not
+    if (auto* pending = PendingComponents_.Find(detachedEvent->Component_); pending != PendingComponents_.end())
+    {
+      PendingComponents_.Erase(pending);
+      return true;
+    }
+
     auto* components = RenderingComponents_.Find(ID);
     checkf(components, "Failed to find component %llu.", ID);
     if (components)
-      components->EraseIf([C = detachedEvent->Component_](Components::ComponentBase* const& Registered) { return Registered == C; });
+      components->TryRemove(OwnerHandle(*detachedEvent->PrevOwner_).Index_);
     return true;
   }
 
@@ -375,6 +383,28 @@ bool RenderingSubSystem::IsComponentHandledByUs(u64 const ID)
   }
   return false;
 }
+bool RenderingSubSystem::TryRegisterComponent(Components::ComponentBase& Component)
+{
+  auto const handle = OwnerHandle(*Component.Owner());
+  if (handle.IsNull())
+    return false;
+
+  u64 const ID         = Component.GetTypeMetaData().ID_;
+  auto*     components = RenderingComponents_.Find(ID);
+  if (!components)
+  {
+    components = RenderingComponents_.TryEmplace(ID);
+    checkf(components, "Failed to register component %llu.", ID);
+  }
+  if (components)
+    components->TryEmplace(handle.Index_, &Component);
+  return true;
+}
+void RenderingSubSystem::RegisterPendingComponents()
+{
+  // Components of owners that are still not spawned stay pending
+  PendingComponents_.EraseIf([this](Components::ComponentBase* Component) { return TryRegisterComponent(*Component); });
+}
 void RenderingSubSystem::CompileShaders()
 {
   { // SpriteComponent
@@ -0,0 +1,68 @@
+#include <Engine/SubSystems/ECS/EntityComponentSubSystem.h>
+#include <UnitTest/UnitTest.h>
+
+namespace UnitTest
+{
+class TestActor : public Engine::Entities::ActorBase
+{
+  GE_DECLARE_CLASS_TYPE_METADATA()
+
+public:
+  i32 Value_ = 0;
+};
+} // namespace UnitTest
+
+GE_DEFINE_TYPE_METADATA(UnitTest::TestActor, Engine::TypeMetaData::Actor)
+
+UNIT_TEST_SUITE(EntityComponentSubSystem)
+{
+  using Engine::Entities::ActorBase;
+
+  UNIT_TEST(ForEachActor_VisitsSpawnedActors)
+  {
+    Engine::EntityComponentSubSystem ecs;
+
+    TestActor* first  = ecs.SpawnActor<TestActor>("First");
+    TestActor* second = ecs.SpawnActor<TestActor>("Second");
+    TestActor* third  = ecs.SpawnActor<TestActor>("Third");
+    UNIT_TEST_REQUIRE(first && second && third);
+    first->Value_  = 1;
+    second->Value_ = 2;
+    third->Value_  = 4;
+
+    // Actors of other classes, even the base one, aren't visited
+    UNIT_TEST_REQUIRE(ecs.SpawnActor<ActorBase>("Base") != nullptr);
+
+    i32 visited = 0;
+    i32 sum     = 0;
+    ecs.ForEachActor<TestActor>([&](TestActor& actor) {
+      ++visited;
+      sum += actor.Value_;
+    });
+    UNIT_TEST_REQUIRE(visited == 3);
+    UNIT_TEST_REQUIRE(sum == 7);
+
+    ecs.DestroyActor(second);
+    visited = 0;
+    sum     = 0;
+    ecs.ForEachActor<TestActor>([&](TestActor& actor) {
+      ++visited;
+      sum += actor.Value_;
+    });
+    UNIT_TEST_REQUIRE(visited == 2);
+    UNIT_TEST_REQUIRE(sum == 5);
+  }
+  UNIT_TEST(ForEachActor_ReachesTheBucketsOfTheMetaData)
+  {
+    // The buckets reached through the metadata are the ones its Factory_ fills
+    Engine::EntityComponentSubSystem ecs;
+    TestActor* actor = ecs.SpawnActor<TestActor>("Actor");
+
+    auto& buckets = *(Core::BucketArray<TestActor>*)TestActor::GetStaticTypeMetaData().Buckets_();
+    bool found = false;
+    for (TestActor& each : buckets)
+      found = found || &each == actor;
+    UNIT_TEST_REQUIRE(found);
+    UNIT_TEST_REQUIRE(ActorBase::GetStaticTypeMetaData().Buckets_ != nullptr);
+  }
+}
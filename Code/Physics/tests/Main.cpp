@@ -1,3 +1,4 @@
+#include <Core/Allocator/GlobalAllocator.h>
 #include <Core/Container/String.h>
 #include <UnitTest/UnitTest.h>
 #include <algorithm>
@@ -49,6 +50,7 @@ int main(int argc, char** argv)
     for (auto& worker : workers)
     {
       worker = std::jthread([&testOptions, &tests, &testId] {
+        Core::GlobalAllocator::ThreadScope allocatorThread;
         int const id = testId.fetch_add(1, std::memory_order_relaxed);
         if (id >= tests.Size())
           return;
@@ -11,7 +11,7 @@ Renderable::Renderable(Kind Kind, Core::Span<f32> Vertices)
   glGenBuffers(1, &VBO_);
   glBindBuffer(GL_ARRAY_BUFFER, VBO_);
   glBufferData(GL_ARRAY_BUFFER, Vertices.AllocSize(), Vertices.Data(), GL_STATIC_DRAW);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, Vertices.AllocSize(), nullptr);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, (GLsizei)Vertices.AllocSize(), nullptr);
   glEnableVertexAttribArray(0);
   glBindVertexArray(0);
 }